@@ -0,0 +1,28 @@
+/*
+* access_check.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This file contains the check policies that a LinkedList uses to guard its element access.
+* CheckedAccess makes pop_front, pop_back, remove, front, back, get_current and at_current throw an
+* empty_collection_exception when there is no element for them to use. UncheckedAccess leaves the test out,
+* so the checks cost nothing in a list whose owner already guards every call; breaking a precondition of one
+* of these functions is then undefined, as for std::list.
+*/
+
+#ifndef SENG1120_ACCESS_CHECK_H
+#define SENG1120_ACCESS_CHECK_H
+
+class CheckedAccess
+{
+public:
+    static const bool enabled = true;    // A call without an element to use throws
+};
+
+class UncheckedAccess
+{
+public:
+    static const bool enabled = false;   // The caller guarantees every call has an element to use
+};
+
+#endif
@@ -0,0 +1,878 @@
+/*
+ * bench.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ *
+ * Benchmark suite for the lists and the browser, with no dependencies beyond the standard library.
+ *
+ *   micro   each list operation (push/pop at both ends, insert, remove, search, clear) on LinkedList with pooled
+ *           and heap nodes, with and without its access checks, and on UnrolledList, and append, splice and
+ *           split_at of lists of that size on LinkedList, at sizes from 10 up to --max-size (default 10^7)
+ *   macro   Browser workloads replayed through execute_command: visit-heavy, back/forward-heavy, remove-heavy
+ *           and bookmark-toggle-heavy, each with a short and a long history limit
+ *   scan    filling a history by churning it like Browser's, then searching it for a missing value and clearing
+ *           it, with ids, std::string URLs and InlineUrl URLs as the elements
+ *   shared  reader threads scanning a list while a writer keeps replacing its oldest entry
+ *   snapshot  restoring a Browser with a full history by replaying its visit commands, against saving it to and
+ *           loading it from a snapshot in memory; an op is one whole browser
+ *   purge   removing a batch of URLs from a full history one remove at a time, against one remove_many by URL,
+ *           and by domain; an op is one whole purge
+ *   complete  autocompleting the 10 most common URLs for prefixes of several lengths, in a full history of
+ *           20000 sites, and listing the most visited sites; an op is one query
+ *   tabs    duplicating a tab with a full history and closing the copy, against copying it by replaying its visits
+ *           into a new tab; handing over to the copy by visiting in it and closing the original, then going back
+ *           and forward through the history it was handed, an op being one step; and then visiting in a copy, which evicts entries it
+ *           shares with the original
+ *   journal the macro workloads without a journal, journaled, and journaled with a compaction every megabyte,
+ *           so the difference is the cost of journaling one command; the journal is written to bench_journal*
+ *           in the current directory and deleted afterwards
+ *
+ * Every measurement is printed as one CSV row:
+ *   section,benchmark,subject,size,ops,ns_per_op,ops_per_s,allocs_per_op
+ * where allocs_per_op counts calls to operator new. For search and clear in the micro section an op is one
+ * whole call; for the scan section it is one visit while churning, or one element visited by search and clear.
+ *
+ * Usage: Bench [--max-size N] [micro] [macro] [scan] [shared] [snapshot] [purge] [complete] [tabs] [journal]    (default: every section)
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "browser.h"
+#include "commands.h"
+#include "concurrent_list.h"
+#include "inline_string.h"
+#include "journal.h"
+#include "linked_list.h"
+#include "output_buffer.h"
+#include "snapshot.h"
+#include "unrolled_list.h"
+#include "url_table.h"
+
+// ---- Allocation counting --------
+
+static std::atomic<long> allocation_count(0);
+
+// Kept out of line with the operator deletes below, or GCC pairs malloc or free with an inlined call to one of them and
+// warns of a mismatch
+__attribute__((noinline)) void *operator new(std::size_t size)
+{
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	void *memory = std::malloc(size > 0 ? size : 1);
+	if (memory == nullptr)
+		throw std::bad_alloc();
+	return memory;
+}
+
+__attribute__((noinline)) void operator delete(void *memory) noexcept
+{
+	std::free(memory);
+}
+
+__attribute__((noinline)) void operator delete(void *memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+// ---- Measuring and reporting --------
+
+typedef std::chrono::steady_clock bench_clock;
+
+// Keeps results alive so the compiler cannot drop the work that produced them
+static volatile long sink;
+
+// Time and allocations since construction
+class Measure
+{
+public:
+	Measure() : start(bench_clock::now()), allocations(allocation_count.load()) {}
+
+	double ns() const { return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count(); }
+	long allocs() const { return allocation_count.load() - allocations; }
+
+private:
+	bench_clock::time_point start;
+	long allocations;
+};
+
+// Running totals for one row of output
+struct Tally
+{
+	long ops;
+	double ns;
+	long allocs;
+
+	Tally() : ops(0), ns(0), allocs(0) {}
+
+	void add(const Measure &measure, long ops) { this->ns += measure.ns(); this->allocs += measure.allocs(); this->ops += ops; }
+};
+
+// Print one CSV row
+static void report(const char *section, const char *benchmark, const std::string &subject, long size, const Tally &tally)
+{
+	double ops = (tally.ops > 0 ? tally.ops : 1);
+	std::printf("%s,%s,%s,%ld,%ld,%.3f,%.0f,%.4f\n", section, benchmark, subject.c_str(), size, tally.ops,
+				tally.ns / ops, tally.ns > 0 ? ops * 1e9 / tally.ns : 0.0, tally.allocs / ops);
+	std::fflush(stdout);
+}
+
+// ---- micro --------
+
+// Fill list with size ids
+template <typename List>
+static void fill(List &list, long size)
+{
+	for (long i = 0; i < size; i++)
+		list.push_back(static_cast<url_id>(i));
+}
+
+// Time every list operation at one size
+template <typename List>
+static void micro_size(const std::string &subject, long size)
+{
+	long repeats = (size < 1000000 ? 1000000 / size : 1); // Do about 10^6 element operations per row
+	long edits = (size < 10000 ? size : 10000);            // insert and remove work in the middle of the list
+	Tally push_back, push_front, pop_front, pop_back, insert, remove, search, clear;
+
+	for (long r = 0; r < repeats; r++)
+	{
+		{
+			List list;
+			Measure measure;
+			for (long i = 0; i < size; i++)
+				list.push_back(static_cast<url_id>(i));
+			push_back.add(measure, size);
+		}
+		{
+			List list;
+			Measure measure;
+			for (long i = 0; i < size; i++)
+				list.push_front(static_cast<url_id>(i));
+			push_front.add(measure, size);
+		}
+		{
+			List list;
+			fill(list, size);
+			Measure measure;
+			long total = 0;
+			for (long i = 0; i < size; i++)
+				total += list.pop_front();
+			pop_front.add(measure, size);
+			sink = total;
+		}
+		{
+			List list;
+			fill(list, size);
+			Measure measure;
+			long total = 0;
+			for (long i = 0; i < size; i++)
+				total += list.pop_back();
+			pop_back.add(measure, size);
+			sink = total;
+		}
+		{
+			List list;
+			fill(list, size);
+			list.seek(static_cast<int>(size / 2));
+			Measure measure;
+			for (long i = 0; i < edits; i++)
+				list.insert(static_cast<url_id>(size + i)); // Values not already in the list
+			insert.add(measure, edits);
+		}
+		{
+			List list;
+			fill(list, size);
+			list.seek(static_cast<int>((size - edits) / 2));
+			Measure measure;
+			long total = 0;
+			for (long i = 0; i < edits; i++)
+				total += list.remove();
+			remove.add(measure, edits);
+			sink = total;
+		}
+		{
+			List list;
+			fill(list, size);
+			Measure measure;
+			list.clear();
+			clear.add(measure, 1);
+		}
+	}
+
+	{
+		List list;
+		fill(list, size);
+		long searches = (size < 10000000 ? 10000000 / size : 1); // Visit about 10^7 elements
+		Measure measure;
+		long found = 0;
+		for (long i = 0; i < searches; i++)
+			found += list.search(static_cast<url_id>(-1));
+		search.add(measure, searches);
+		sink = found;
+	}
+
+	report("micro", "push_back", subject, size, push_back);
+	report("micro", "push_front", subject, size, push_front);
+	report("micro", "pop_front", subject, size, pop_front);
+	report("micro", "pop_back", subject, size, pop_back);
+	report("micro", "insert", subject, size, insert);
+	report("micro", "remove", subject, size, remove);
+	report("micro", "search_miss", subject, size, search);
+	report("micro", "clear", subject, size, clear);
+}
+
+// Time moving a whole list onto the end of another, into its middle, and splitting one, with all the lists
+// sharing their storage
+template <typename List, typename Alloc>
+static void micro_transfer(const std::string &subject, long size)
+{
+	long repeats = (size < 1000000 ? 1000000 / size : 1);
+	Tally append, splice, split;
+	for (long r = 0; r < repeats; r++)
+	{
+		Alloc alloc;
+		List list(alloc);
+		List other(alloc);
+		fill(list, size);
+		fill(other, size);
+		{
+			Measure measure;
+			list.append(std::move(other));
+			append.add(measure, 1);
+		}
+		for (long i = 0; i < size; i++)
+			other.push_back(static_cast<url_id>(2 * size + i)); // Values not already in the list
+		typename List::Cursor middle(list);
+		for (long i = 0; i < size; i++)
+			middle.forward();
+		{
+			Measure measure;
+			list.splice(middle, other);
+			splice.add(measure, 1);
+		}
+		middle.begin(); // The splice moved the node middle is on along, so find the last size nodes instead
+		for (long i = 0; i < 2 * size; i++)
+			middle.forward();
+		{
+			Measure measure;
+			list.split_at(middle, other);
+			split.add(measure, 1);
+		}
+		sink = list.size() + other.size();
+	}
+	report("micro", "append", subject, size, append);
+	report("micro", "splice", subject, size, splice);
+	report("micro", "split_at", subject, size, split);
+}
+
+static void run_micro(long max_size)
+{
+	for (long size = 10; size <= max_size; size *= 10)
+	{
+		micro_size<LinkedList<url_id> >("LinkedList-pool", size);
+		micro_size<LinkedList<url_id, NodePool<url_id>, NoIndex<url_id>, UncheckedAccess> >("LinkedList-pool-unchecked", size);
+		micro_size<LinkedList<url_id, HeapAllocator<url_id> > >("LinkedList-heap", size);
+		micro_size<LinkedList<url_id, NodePool<url_id>, HashIndex<url_id> > >("LinkedList-pool-hashed", size);
+		micro_size<UnrolledList<url_id> >("UnrolledList", size);
+		micro_transfer<LinkedList<url_id>, NodePool<url_id> >("LinkedList-pool", size);
+		micro_transfer<LinkedList<url_id, NodePool<url_id>, HashIndex<url_id> >, NodePool<url_id> >("LinkedList-pool-hashed", size);
+	}
+}
+
+// ---- macro --------
+
+// The share of each command in a workload, out of 100
+struct Workload
+{
+	const char *name;
+	int visit;
+	int back;
+	int forward;
+	int remove;
+	int bookmark;
+	int visit_bookmark;
+	int print;
+	int urls;           // Number of distinct URLs visited
+};
+
+// Generate count commands for a workload
+static std::vector<std::string> make_commands(const Workload &workload, int count)
+{
+	std::mt19937 random(1120);
+	std::vector<std::string> commands;
+	for (int i = 0; i < count; i++)
+	{
+		int pick = static_cast<int>(random() % 100);
+		std::string url = "www.site" + std::to_string(random() % workload.urls) + ".com";
+		if ((pick -= workload.visit) < 0)
+			commands.push_back("v " + url);
+		else if ((pick -= workload.back) < 0)
+			commands.push_back("< " + std::to_string(1 + random() % 8));
+		else if ((pick -= workload.forward) < 0)
+			commands.push_back("> " + std::to_string(1 + random() % 8));
+		else if ((pick -= workload.remove) < 0)
+			commands.push_back("r " + url);
+		else if ((pick -= workload.bookmark) < 0)
+			commands.push_back("b");
+		else if ((pick -= workload.visit_bookmark) < 0)
+			commands.push_back("V " + std::to_string(random() % 16));
+		else
+			commands.push_back("p");
+	}
+	return commands;
+}
+
+static void run_macro()
+{
+	const Workload workloads[] = {
+		{ "visit_heavy", 90, 5, 5, 0, 0, 0, 0, 10000 },
+		{ "back_forward_heavy", 10, 45, 45, 0, 0, 0, 0, 1000 },
+		{ "remove_heavy", 50, 0, 0, 50, 0, 0, 0, 200 },
+		{ "bookmark_toggle_heavy", 40, 0, 0, 0, 50, 8, 2, 200 },
+	};
+	const int limits[] = { 10, 10000 };
+	DiscardBuffer discard_out;
+	DiscardBuffer discard_err;
+	std::ostream out(&discard_out);
+	std::ostream err(&discard_err);
+
+	for (std::size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++)
+	{
+		std::vector<std::string> commands = make_commands(workloads[w], 200000);
+		for (std::size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+		{
+			Browser browser(out, "newcastle.edu.au", limits[l]);
+			Tally tally;
+			Measure measure;
+			for (std::size_t i = 0; i < commands.size(); i++)
+				execute_command(browser, commands[i], out, err);
+			tally.add(measure, static_cast<long>(commands.size()));
+			report("macro", workloads[w].name, "Browser", limits[l], tally);
+		}
+	}
+}
+
+// ---- snapshot --------
+
+static void run_snapshot()
+{
+	const int limits[] = { 10, 1000, 100000 };
+	DiscardBuffer discard_out;
+	std::ostream out(&discard_out);
+
+	for (std::size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+	{
+		int limit = limits[l];
+		int browsers = 1000000 / limit; // About a million history entries restored for each limit
+		std::vector<std::string> urls;
+		std::mt19937 random(1120);
+		for (int i = 0; i < limit; i++)
+			urls.push_back("www.site" + std::to_string(random() % (limit / 2 + 1)) + ".com");
+
+		std::vector<std::string> commands; // Fill the history, then bookmark a tenth of it
+		for (int i = 0; i < limit; i++)
+			commands.push_back("v " + urls[i]);
+		for (int i = 0; i < limit; i += 10)
+		{
+			commands.push_back("v " + urls[i]);
+			commands.push_back("b");
+		}
+
+		Tally replay;
+		for (int b = 0; b < browsers; b++)
+		{
+			Measure measure;
+			Browser browser(out, "newcastle.edu.au", limit);
+			for (std::size_t i = 0; i < commands.size(); i++)
+				execute_command(browser, commands[i], out, out);
+			replay.add(measure, 1);
+		}
+
+		Browser original(out, "newcastle.edu.au", limit);
+		for (std::size_t i = 0; i < commands.size(); i++)
+			execute_command(original, commands[i], out, out);
+
+		Tally save;
+		std::string data;
+		for (int b = 0; b < browsers; b++)
+		{
+			data.clear();
+			Measure measure;
+			BrowserSnapshot::encode(original, data);
+			save.add(measure, 1);
+		}
+
+		Tally load;
+		for (int b = 0; b < browsers; b++)
+		{
+			Measure measure;
+			Browser browser(out, "newcastle.edu.au", limit);
+			BrowserSnapshot::decode(browser, data.data(), data.size());
+			load.add(measure, 1);
+			sink = browser.count_history();
+		}
+
+		report("snapshot", "restore_by_replay", "Browser", limit, replay);
+		report("snapshot", "save", "Browser", limit, save);
+		report("snapshot", "restore_from_snapshot", "Browser", limit, load);
+	}
+}
+
+// ---- purge --------
+
+static void run_purge()
+{
+	const int limit = 100000;
+	const int site_count = 20000;
+	const int key_counts[] = { 10, 1000, 10000 };
+	DiscardBuffer discard_out;
+	std::ostream out(&discard_out);
+
+	std::vector<std::string> visits;
+	std::mt19937 random(1120);
+	for (int i = 0; i < limit; i++)
+		visits.push_back("www.site" + std::to_string(random() % site_count) + ".com/page" + std::to_string(random() % 4));
+
+	for (std::size_t k = 0; k < sizeof(key_counts) / sizeof(key_counts[0]); k++)
+	{
+		int key_count = key_counts[k];
+		std::vector<std::string> urls(key_count);
+		std::vector<std::string> domains(key_count);
+		std::vector<std::string_view> url_keys(key_count);
+		std::vector<std::string_view> domain_keys(key_count);
+		for (int i = 0; i < key_count; i++)
+		{
+			domains[i] = "site" + std::to_string(i * (site_count / key_count)) + ".com";
+			urls[i] = "www." + domains[i] + "/page0";
+			url_keys[i] = urls[i];
+			domain_keys[i] = domains[i];
+		}
+
+		Tally tallies[3]; // One remove at a time, remove_many by URL, remove_many by domain
+		for (int run = 0; run < 3; run++)
+		{
+			for (int repeat = 0; repeat < 3; repeat++)
+			{
+				Browser browser(out, "newcastle.edu.au", limit);
+				for (int i = 0; i < limit; i++)
+					browser.visit(visits[i]);
+				Measure measure;
+				if (run == 0)
+				{
+					for (int i = 0; i < key_count; i++)
+						browser.remove(urls[i]);
+				}
+				else
+					browser.remove_many(run == 1 ? url_keys : domain_keys, run == 1 ? REMOVE_URL : REMOVE_DOMAIN);
+				tallies[run].add(measure, 1);
+				sink = browser.count_history();
+			}
+		}
+		report("purge", "remove_each", "Browser", key_count, tallies[0]);
+		report("purge", "remove_many_url", "Browser", key_count, tallies[1]);
+		report("purge", "remove_many_domain", "Browser", key_count, tallies[2]);
+	}
+}
+
+// ---- complete --------
+
+static void run_complete()
+{
+	const int limit = 100000;
+	const int site_count = 20000;
+	const int queries = 100000;
+	const char *prefixes[] = { "www.", "www.site1", "www.site12", "www.site1234.com/", "www.none" };
+	DiscardBuffer discard_out;
+	std::ostream out(&discard_out);
+
+	Browser browser(out, "newcastle.edu.au", limit);
+	std::mt19937 random(1120);
+	for (int i = 0; i < limit; i++)
+		browser.visit("www.site" + std::to_string(random() % site_count) + ".com/page" + std::to_string(random() % 4));
+
+	for (std::size_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++)
+	{
+		Tally tally;
+		Measure measure;
+		for (int i = 0; i < queries; i++)
+			sink = static_cast<long>(browser.complete(prefixes[p], 10).size());
+		tally.add(measure, queries);
+		report("complete", prefixes[p], "Browser", limit, tally);
+	}
+
+	const int counts[] = { 1, 10, 100 };
+	for (std::size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+	{
+		Tally tally;
+		Measure measure;
+		for (int i = 0; i < queries; i++)
+			sink = static_cast<long>(browser.most_visited(counts[c]).size());
+		tally.add(measure, queries);
+		report("complete", ("most_visited_" + std::to_string(counts[c])).c_str(), "Browser", limit, tally);
+	}
+}
+
+// ---- tabs --------
+
+static void run_tabs()
+{
+	const int limits[] = { 1000, 100000 };
+	const int copies = 10000;
+	DiscardBuffer discard_out;
+	std::ostream out(&discard_out);
+
+	for (std::size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+	{
+		int limit = limits[l];
+		std::vector<std::string> visits;
+		std::mt19937 random(1120);
+		for (int i = 0; i < 2 * limit; i++)
+			visits.push_back("www.site" + std::to_string(random() % 20000) + ".com/page" + std::to_string(random() % 4));
+
+		Browser browser(out, "newcastle.edu.au", limit);
+		for (int i = 0; i < limit; i++)
+			browser.visit(visits[i]);
+
+		Tally duplicate;
+		Measure measure;
+		for (int i = 0; i < copies; i++)
+		{
+			browser.duplicate_tab();
+			browser.close_tab();
+		}
+		duplicate.add(measure, copies);
+
+		Tally handover; // The copy outlives the original every time, so its history must not pile up in pieces
+		Measure handover_measure;
+		for (int i = 0; i < copies; i++)
+		{
+			browser.duplicate_tab();
+			browser.visit(visits[limit + i % limit]);
+			browser.switch_tab(0);
+			browser.close_tab();
+		}
+		handover.add(handover_measure, copies);
+
+		Tally back_forward;
+		Measure back_forward_measure;
+		for (int i = 0; i < 100; i++)
+		{
+			browser.back(limit);
+			browser.forward(limit);
+		}
+		back_forward.add(back_forward_measure, 200 * static_cast<long>(limit));
+
+		Tally replay;
+		for (int repeat = 0; repeat < 3; repeat++)
+		{
+			Measure replay_measure;
+			browser.new_tab();
+			for (int i = 0; i < limit; i++)
+				browser.visit(visits[i]);
+			replay.add(replay_measure, 1);
+			browser.close_tab();
+		}
+
+		Tally diverge; // Each visit in the copy evicts an entry it shares with the original, until none are left
+		browser.duplicate_tab();
+		Measure diverge_measure;
+		for (int i = limit; i < 2 * limit; i++)
+			browser.visit(visits[i]);
+		diverge.add(diverge_measure, limit);
+		sink = browser.count_history();
+
+		report("tabs", "duplicate_and_close", "Browser", limit, duplicate);
+		report("tabs", "copy_by_replay", "Browser", limit, replay);
+		report("tabs", "duplicate_visit_close_original", "Browser", limit, handover);
+		report("tabs", "back_forward_after_handover", "Browser", limit, back_forward);
+		report("tabs", "visit_after_duplicate", "Browser", limit, diverge);
+	}
+}
+
+// ---- journal --------
+
+// Delete the snapshot and every segment of the journal at path
+static void remove_journal(const std::string &path, std::uint64_t last)
+{
+	std::remove(path.c_str());
+	for (std::uint64_t generation = 0; generation <= last; generation++)
+		std::remove((path + ".log." + std::to_string(generation)).c_str());
+}
+
+static void run_journal()
+{
+	const Workload workloads[] = {
+		{ "visit_heavy", 90, 5, 5, 0, 0, 0, 0, 10000 },
+		{ "back_forward_heavy", 10, 45, 45, 0, 0, 0, 0, 1000 },
+		{ "remove_heavy", 50, 0, 0, 50, 0, 0, 0, 200 },
+		{ "bookmark_toggle_heavy", 40, 0, 0, 0, 50, 8, 2, 200 },
+	};
+	const std::string path = "bench_journal";
+	const int limit = 10000;
+	DiscardBuffer discard_out;
+	DiscardBuffer discard_err;
+	std::ostream out(&discard_out);
+	std::ostream err(&discard_err);
+
+	for (std::size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++)
+	{
+		std::vector<std::string> commands = make_commands(workloads[w], 1000000);
+		std::string name = workloads[w].name;
+		for (int run = 0; run < 3; run++) // Plain, journaled, journaled and compacting
+		{
+			remove_journal(path, 1000);
+			Browser browser(out, "newcastle.edu.au", limit);
+			JournalOptions options = { false, JOURNAL_BATCH_BYTES, static_cast<std::size_t>(run == 2 ? 1024 * 1024 : 0) };
+			BrowserJournal *journal = (run > 0 ? new BrowserJournal(browser, path, options) : nullptr);
+			Tally tally;
+			Measure measure;
+			for (std::size_t i = 0; i < commands.size(); i++)
+			{
+				execute_command(browser, commands[i], out, err);
+				if (journal != nullptr && i % 1000 == 999)
+					journal->commit(); // As a driver would between groups of commands
+			}
+			if (journal != nullptr)
+			{
+				journal->commit();
+				journal->wait();
+			}
+			tally.add(measure, static_cast<long>(commands.size()));
+			std::uint64_t last = (journal != nullptr ? journal->generation() : 0);
+			delete journal;
+			remove_journal(path, last);
+			report("journal", name.c_str(), run == 0 ? "Browser" : (run == 1 ? "Browser+journal" : "Browser+journal+compact"),
+				   limit, tally);
+		}
+	}
+}
+
+// ---- scan --------
+
+// Make the value stored for visit i
+template <typename T>
+static T make_value(int i);
+
+// Write the URL for visit i into text, returning its length
+static int format_url(int i, char (&text)[64])
+{
+	return std::snprintf(text, sizeof(text), "www.site%d.com/page/%d", i % 977, i);
+}
+
+template <>
+std::string make_value<std::string>(int i)
+{
+	char text[64];
+	return std::string(text, format_url(i, text));
+}
+
+template <>
+InlineUrl make_value<InlineUrl>(int i)
+{
+	char text[64];
+	return InlineUrl(std::string_view(text, format_url(i, text)));
+}
+
+template <>
+url_id make_value<url_id>(int i)
+{
+	return static_cast<url_id>(i);
+}
+
+// Fill a list to length through 4 * length visits, dropping the oldest entry once the list is full
+template <typename List, typename T>
+static void churn(List &list, int length)
+{
+	for (int i = 0; i < 4 * length; i++)
+	{
+		list.push_back(make_value<T>(i));
+		if (list.size() > length)
+			list.pop_front();
+	}
+}
+
+// Time churning a list, per visit, then searches for an absent value and a clear on it, per element visited
+template <typename List, typename T>
+static void scan_length(const std::string &subject, int length)
+{
+	int searches = 20000000 / length + 1; // Visit about the same number of elements at every length
+	T missing = make_value<T>(-1);
+	Tally visit, search, clear;
+	long found = 0;
+	for (int round = 0; round < 3; round++)
+	{
+		List list;
+		Measure churning;
+		churn<List, T>(list, length);
+		visit.add(churning, 4L * length);
+
+		Measure measure;
+		for (int i = 0; i < searches; i++)
+			found += list.search(missing);
+		search.add(measure, static_cast<long>(searches) * length);
+
+		Measure clearing;
+		list.clear();
+		clear.add(clearing, length);
+	}
+	sink = found;
+	report("scan", "visit_churned", subject, length, visit);
+	report("scan", "search_miss_churned", subject, length, search);
+	report("scan", "clear_churned", subject, length, clear);
+}
+
+static void run_scan(long max_size)
+{
+	for (int length = 1000; length <= 100000 && length <= max_size; length *= 10)
+	{
+		scan_length<LinkedList<url_id, HeapAllocator<url_id> >, url_id>("LinkedList-heap", length);
+		scan_length<LinkedList<url_id>, url_id>("LinkedList-pool", length);
+		scan_length<UnrolledList<url_id>, url_id>("UnrolledList", length);
+		scan_length<LinkedList<std::string, HeapAllocator<std::string> >, std::string>("LinkedList-heap:string", length);
+		scan_length<LinkedList<std::string>, std::string>("LinkedList-pool:string", length);
+		scan_length<UnrolledList<std::string>, std::string>("UnrolledList:string", length);
+		scan_length<LinkedList<InlineUrl, HeapAllocator<InlineUrl> >, InlineUrl>("LinkedList-heap:inline", length);
+		scan_length<LinkedList<InlineUrl>, InlineUrl>("LinkedList-pool:inline", length);
+		scan_length<UnrolledList<InlineUrl>, InlineUrl>("UnrolledList:inline", length);
+	}
+}
+
+// ---- shared --------
+
+// A LinkedList shared by holding a mutex for every operation, since even search moves its cursor
+struct LockedList
+{
+	LinkedList<url_id> list;
+	std::mutex lock;
+
+	void push_back(url_id id) { std::lock_guard<std::mutex> guard(lock); list.push_back(id); }
+	void replace_oldest(url_id id) { std::lock_guard<std::mutex> guard(lock); list.pop_front(); list.push_back(id); }
+	long scan(url_id missing) { std::lock_guard<std::mutex> guard(lock); list.search(missing); return list.size(); }
+};
+
+// A ConcurrentList, read through a cursor without locking
+struct SharedList
+{
+	ConcurrentList<url_id> list;
+
+	void push_back(url_id id) { list.push_back(id); }
+	void replace_oldest(url_id id) { list.pop_front(); list.push_back(id); }
+	long scan(url_id missing) { ConcurrentList<url_id>::Cursor cursor(list); cursor.search(missing); return list.size(); }
+};
+
+// Scan a shared list of length ids from readers threads while one writer replaces the oldest id, for about
+// 0.3 seconds, reporting the elements scanned and the writes made
+template <typename Shared>
+static void shared_run(const std::string &subject, int length, int readers)
+{
+	Shared shared;
+	for (int i = 0; i < length; i++)
+		shared.push_back(static_cast<url_id>(i));
+
+	std::atomic<bool> stop(false);
+	std::atomic<long> scanned(0);
+	std::vector<std::thread> threads;
+	Measure measure;
+	for (int r = 0; r < readers; r++)
+	{
+		threads.push_back(std::thread([&shared, &stop, &scanned]()
+		{
+			long elements = 0;
+			while (!stop.load())
+				elements += shared.scan(static_cast<url_id>(-1));
+			scanned += elements;
+		}));
+	}
+
+	long writes = 0;
+	while (measure.ns() < 3e8)
+	{
+		shared.replace_oldest(static_cast<url_id>(length + writes));
+		writes++;
+	}
+	stop = true;
+	for (std::size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	Tally reads, written;
+	reads.add(measure, scanned.load());
+	written.add(measure, writes);
+	std::string name = subject + ":readers=" + std::to_string(readers);
+	report("shared", "scan_while_writing", name, length, reads);
+	report("shared", "write_while_scanning", name, length, written);
+}
+
+static void run_shared()
+{
+	for (int readers = 1; readers <= 4; readers *= 2)
+	{
+		shared_run<LockedList>("LinkedList+mutex", 1000, readers);
+		shared_run<SharedList>("ConcurrentList", 1000, readers);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	long max_size = 10000000;
+	std::vector<std::string_view> sections;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+		if (arg == "--max-size" && i + 1 < argc)
+			max_size = std::atol(argv[++i]);
+		else if (arg == "micro" || arg == "macro" || arg == "scan" || arg == "shared" || arg == "snapshot" ||
+				 arg == "purge" || arg == "complete" || arg == "tabs" || arg == "journal")
+			sections.push_back(arg);
+		else
+		{
+			std::fprintf(stderr, "Usage: %s [--max-size N] [micro] [macro] [scan] [shared] [snapshot] [purge] [complete] [tabs] [journal]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (sections.empty())
+	{
+		sections.push_back("micro");
+		sections.push_back("macro");
+		sections.push_back("scan");
+		sections.push_back("shared");
+		sections.push_back("snapshot");
+		sections.push_back("purge");
+		sections.push_back("complete");
+		sections.push_back("tabs");
+		sections.push_back("journal");
+	}
+
+	std::printf("section,benchmark,subject,size,ops,ns_per_op,ops_per_s,allocs_per_op\n");
+	for (std::size_t i = 0; i < sections.size(); i++)
+	{
+		if (sections[i] == "micro")
+			run_micro(max_size);
+		else if (sections[i] == "macro")
+			run_macro();
+		else if (sections[i] == "scan")
+			run_scan(max_size);
+		else if (sections[i] == "snapshot")
+			run_snapshot();
+		else if (sections[i] == "purge")
+			run_purge();
+		else if (sections[i] == "complete")
+			run_complete();
+		else if (sections[i] == "tabs")
+			run_tabs();
+		else if (sections[i] == "journal")
+			run_journal();
+		else
+			run_shared();
+	}
+	return 0;
+}
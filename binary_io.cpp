@@ -0,0 +1,169 @@
+/*
+ * binary_io.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "binary_io.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Append a u32 in little-endian order
+void put_u32(std::string &data, std::uint32_t value)
+{
+	char bytes[4];
+	for (int i = 0; i < 4; i++)
+		bytes[i] = static_cast<char>(value >> (8 * i));
+	data.append(bytes, 4);
+}
+
+// Append a u64 in little-endian order
+void put_u64(std::string &data, std::uint64_t value)
+{
+	put_u32(data, static_cast<std::uint32_t>(value));
+	put_u32(data, static_cast<std::uint32_t>(value >> 32));
+}
+
+// Append a string as its length and bytes
+void put_string(std::string &data, std::string_view text)
+{
+	put_u32(data, static_cast<std::uint32_t>(text.size()));
+	data.append(text.data(), text.size());
+}
+
+// Return the 32-bit FNV-1a hash of data
+std::uint32_t checksum(std::string_view data)
+{
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = 0; i < data.size(); i++)
+	{
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// ---- ByteReader --------
+
+ByteReader::ByteReader(const char *data, std::size_t size, const char *what)
+		: next(data), end(data + size), what(what)
+{
+}
+
+// Return the number of bytes not read yet
+std::size_t ByteReader::remaining() const
+{
+	return static_cast<std::size_t>(end - next);
+}
+
+// Read one byte
+char ByteReader::byte()
+{
+	need(1);
+	return *next++;
+}
+
+// Read a little-endian u32
+std::uint32_t ByteReader::u32()
+{
+	need(4);
+	std::uint32_t value = 0;
+	for (int i = 0; i < 4; i++)
+		value |= static_cast<std::uint32_t>(static_cast<unsigned char>(next[i])) << (8 * i);
+	next += 4;
+	return value;
+}
+
+// Read a little-endian u64
+std::uint64_t ByteReader::u64()
+{
+	std::uint64_t low = u32();
+	return low | (static_cast<std::uint64_t>(u32()) << 32);
+}
+
+// Read a length-prefixed string as a view into the data
+std::string_view ByteReader::string()
+{
+	return bytes(u32());
+}
+
+// Read raw bytes as a view into the data
+std::string_view ByteReader::bytes(std::size_t size)
+{
+	need(size);
+	std::string_view text(next, size);
+	next += size;
+	return text;
+}
+
+// Read a count of u32 fields, checking that they fit in what is left
+std::uint32_t ByteReader::count()
+{
+	std::uint32_t n = u32();
+	if (n > remaining() / 4)
+		throw std::runtime_error(std::string(what) + " is truncated.");
+	return n;
+}
+
+// Return where the next field starts
+const char *ByteReader::position() const
+{
+	return next;
+}
+
+void ByteReader::need(std::size_t bytes) const
+{
+	if (bytes > remaining())
+		throw std::runtime_error(std::string(what) + " is truncated.");
+}
+
+// ---- MappedFile --------
+
+MappedFile::MappedFile(const std::string &path)
+		: data(nullptr), size(0)
+{
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+	struct stat info;
+	if (::fstat(fd, &info) != 0)
+	{
+		int error = errno;
+		::close(fd);
+		throw std::runtime_error("Cannot read " + path + ": " + std::strerror(error));
+	}
+	size = static_cast<std::size_t>(info.st_size);
+	if (size > 0) // An empty file cannot be mapped
+	{
+		void *mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED)
+		{
+			int error = errno;
+			::close(fd);
+			throw std::runtime_error("Cannot map " + path + ": " + std::strerror(error));
+		}
+		data = static_cast<const char *>(mapped);
+		::posix_madvise(mapped, size, POSIX_MADV_SEQUENTIAL); // Read once, front to back
+	}
+	::close(fd); // The mapping stays valid without the descriptor
+}
+
+MappedFile::~MappedFile()
+{
+	if (data != nullptr)
+		::munmap(const_cast<char *>(data), size);
+}
+
+// Return true if a file exists at path
+bool file_exists(const std::string &path)
+{
+	struct stat info;
+	return ::stat(path.c_str(), &info) == 0;
+}
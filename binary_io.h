@@ -0,0 +1,145 @@
+/*
+* binary_io.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* Helpers shared by the binary files the browser writes, snapshots and journals: little-endian encoding and
+* decoding of fixed-size fields and length-prefixed strings, and read-only memory mapping of a whole file.
+* Decoding throws std::runtime_error rather than reading past the end of its data.
+*/
+
+#ifndef SENG1120_BINARY_IO_H
+#define SENG1120_BINARY_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/*
+* Append a u32 to data in little-endian order.
+*/
+void put_u32(std::string& data, std::uint32_t value);
+
+/*
+* Append a u64 to data in little-endian order.
+*/
+void put_u64(std::string& data, std::uint64_t value);
+
+/*
+* Append a string to data as its u32 length and its bytes.
+*/
+void put_string(std::string& data, std::string_view text);
+
+/*
+* Return the 32-bit FNV-1a hash of data, used to detect torn or damaged writes.
+*/
+std::uint32_t checksum(std::string_view data);
+
+class ByteReader
+{
+public:
+    /**
+     * what names the data in error messages, such as "Snapshot".
+     *
+     * Precondition:  data points to size readable bytes, which outlive the reader.
+     * Postcondition: The reader is at the first byte.
+     */
+    ByteReader(const char* data, std::size_t size, const char* what = "Data");
+
+    /**
+     * Precondition:  None
+     * Postcondition: The number of bytes not read yet is returned.
+     */
+    std::size_t remaining() const;
+
+    /**
+     * Precondition:  None
+     * Postcondition: The next byte has been read and returned.
+     */
+    char byte();
+
+    /**
+     * Precondition:  None
+     * Postcondition: The next little-endian u32 has been read and returned.
+     */
+    std::uint32_t u32();
+
+    /**
+     * Precondition:  None
+     * Postcondition: The next little-endian u64 has been read and returned.
+     */
+    std::uint64_t u64();
+
+    /**
+     * Read a length-prefixed string, as a view into the data rather than a copy.
+     *
+     * Precondition:  None
+     * Postcondition: The string has been read and returned.
+     */
+    std::string_view string();
+
+    /**
+     * Read size raw bytes, as a view into the data.
+     *
+     * Precondition:  None
+     * Postcondition: The bytes have been read and returned.
+     */
+    std::string_view bytes(std::size_t size);
+
+    /**
+     * Read a count of u32 fields that follow, checking that that many fit in what is left.
+     *
+     * Precondition:  None
+     * Postcondition: The count has been read and returned.
+     */
+    std::uint32_t count();
+
+    /**
+     * Precondition:  None
+     * Postcondition: A pointer to the next unread byte is returned, so a run of fields can be read again.
+     */
+    const char* position() const;
+
+private:
+    void need(std::size_t bytes) const;         // Throw unless that many bytes are left
+
+    const char* next;
+    const char* end;
+    const char* what;
+};
+
+/*
+* A file mapped read-only into memory, unmapped when destroyed. An empty file is not mapped and has a null data.
+*/
+class MappedFile
+{
+public:
+    /**
+     * Map the whole of a file, throwing std::runtime_error if it cannot be opened or mapped.
+     *
+     * Precondition:  None
+     * Postcondition: data points to the contents of the file and size is its length.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * Precondition:  None
+     * Postcondition: The file is no longer mapped.
+     */
+    ~MappedFile();
+
+    const char* data;
+    std::size_t size;
+
+private:
+    MappedFile(const MappedFile&);              // Not copyable
+    MappedFile& operator=(const MappedFile&);
+};
+
+/*
+* Return true if a file exists at path.
+*/
+bool file_exists(const std::string& path);
+
+#endif
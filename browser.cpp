@@ -5,23 +5,92 @@
  */
 
 #include "browser.h"
+#include "journal.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+// The key an id matches, once worked out by remove_many
+static const int KEY_UNKNOWN = -2;
+static const int KEY_NONE = -1;
+
+// Return the host of a URL: what follows any scheme, up to the first '/', ':', '?' or '#'
+static std::string_view url_host(std::string_view url)
+{
+	std::size_t scheme = url.find("://");
+	if (scheme != std::string_view::npos)
+		url.remove_prefix(scheme + 3);
+	return url.substr(0, url.find_first_of("/:?#"));
+}
+
+// Return the number of the most specific domain or prefix key that url matches, or KEY_NONE
+static int match_key(std::string_view url, RemoveMatch match, const std::unordered_map<std::string_view, int> &keys,
+										 const std::vector<std::size_t> &lengths)
+{
+	std::unordered_map<std::string_view, int>::const_iterator found;
+	if (match == REMOVE_DOMAIN)
+	{
+		std::string_view host = url_host(url);
+		while (true) // The host itself, then each parent domain in turn
+		{
+			if ((found = keys.find(host)) != keys.end())
+				return found->second;
+			std::size_t dot = host.find('.');
+			if (dot == std::string_view::npos)
+				return KEY_NONE;
+			host.remove_prefix(dot + 1);
+		}
+	}
+	for (std::size_t i = lengths.size(); i-- > 0;) // Longest prefix first
+	{
+		if (lengths[i] <= url.size() && (found = keys.find(url.substr(0, lengths[i]))) != keys.end())
+			return found->second;
+	}
+	return KEY_NONE;
+}
 
 // Constructor for Browser
-// Initializes the browser with a homepage and a history limit
+// Initializes the browser with a homepage and a history limit, printing to std::cout
 Browser::Browser(const std::string &homepage, int history_limit)
-		: history(new LinkedList<std::string>()),		// Create a new LinkedList for history
-			bookmarks(new LinkedList<std::string>()), // Create a new LinkedList for bookmarks
+		: Browser(std::cout, homepage, history_limit)
+{
+}
+
+// Constructor for Browser
+// Initializes the browser with a homepage and a history limit, printing to out
+Browser::Browser(std::ostream &out, const std::string &homepage, int history_limit)
+		: active(0),																// Start with one tab
+			history(new HistoryList()),								// Create a new LinkedList for history
+			bookmarks(new BookmarkList()),						// Create a new LinkedList for bookmarks
 			history_limit(history_limit),							// Set history limit
-			homepage(homepage)												// Set homepage
+			homepage(homepage),												// Set homepage
+			out(&out),																// Set where to print
+			journal(nullptr)													// Not journaled until a BrowserJournal attaches
 {
-	visit(homepage); // Start with the homepage in the history
+	Tab first = { std::vector<SharedPiece>(), 0, history, 0, HistoryList::const_iterator(), 0 };
+	tabs.push_back(first);
+	history->reserve(history_limit); // Set aside room for a full history, so visit does not allocate storage
+	visit(homepage);								 // Start with the homepage in the history
 }
 
 // Destructor for Browser
-// Deletes the history and bookmarks linked lists
+// Deletes the history of every tab and the bookmarks linked list
 Browser::~Browser()
 {
-	delete history;		// Delete history list
+	for (std::size_t i = 0; i < tabs.size(); i++)
+	{
+		for (const SharedPiece &piece : tabs[i].shared) // Delete each run with the last tab that refers to it
+		{
+			SharedRun *run = piece.run;
+			run->starts.pop_back();
+			if (run->starts.empty())
+			{
+				delete run->entries;
+				delete run;
+			}
+		}
+		delete tabs[i].history; // Delete history list
+	}
 	delete bookmarks; // Delete bookmarks list
 }
 
@@ -29,96 +98,441 @@ Browser::~Browser()
 const std::string &Browser::get_current_site()
 {
 	// If history is empty, return the homepage
-	if (history->empty())
+	if (count_history() == 0)
 		return homepage;
 	else
-		return history->get_current(); // Return the current site from the history
+		return urls.lookup(current_id(tabs[active])); // Return the current site from the history
 }
 
 // Visit a new URL and add it to the history
-void Browser::visit(const std::string &url)
+void Browser::visit(std::string_view url)
+{
+	visit_id(urls.intern(url)); // Each distinct URL is stored once, in the URL table
+	if (journal != nullptr)
+		journal->record('v', url);
+}
+
+// Visit an interned URL and add it to the history
+void Browser::visit_id(url_id url)
 {
+	Tab &tab = tabs[active];
 	// If history is empty or the current URL is not the same as the new URL
-	if (history->empty() || history->get_current() != url)
+	if (count_history() == 0 || current_id(tab) != url)
 	{
+		urls.retain(url); // Retain first, in case the evicted entry is the last other reference to url
+
 		// Maintain history limit by removing the oldest entry if exceeded
-		if (history->size() >= history_limit)
-			history->pop_front(); // Remove the oldest URL
+		if (count_history() >= history_limit)
+			evict_oldest();
 
 		history->push_back(url); // Add new URL to history
 		history->end();					 // Set current to the new last element
+		tab.piece = tab.shared.size();
+		ranking.visited(url);
 	}
 }
 
+// Return the current entry of a tab
+url_id Browser::current_id(const Tab &tab) const
+{
+	return tab.piece < tab.shared.size() ? *tab.at : tab.history->get_current();
+}
+
+// Remove the oldest entry of the current tab; visit_id puts current back on the newest entry straight after
+void Browser::evict_oldest()
+{
+	Tab &tab = tabs[active];
+	if (tab.shared.empty())
+	{
+		release_entry(history->pop_front()); // Remove the oldest URL
+	}
+	else // The shared entries are the oldest, and are left in their run for the other tabs that have them
+	{
+		SharedPiece &oldest = tab.shared.front();
+		tab.shared_count--;
+		oldest.start++;
+		if (oldest.start < oldest.run->entries->size())
+		{
+			++oldest.first;
+			leave_run(oldest.run, oldest.start - 1, oldest.start);
+		}
+		else
+		{
+			leave_run(oldest.run, oldest.start - 1, -1);
+			tab.shared.erase(tab.shared.begin());
+			fold_runs();
+		}
+	}
+	BROWSER_STAT(STAT_HISTORY_EVICTIONS, 1);
+}
+
+// Move one start in run to moved, or drop it if moved is -1, releasing the entries no tab starts at or before
+void Browser::leave_run(SharedRun *run, int start, int moved)
+{
+	std::vector<int> &starts = run->starts;
+	std::vector<int>::iterator found = std::find(starts.begin(), starts.end(), start);
+	if (moved >= 0)
+	{
+		*found = moved;
+	}
+	else
+	{
+		*found = starts.back();
+		starts.pop_back();
+	}
+	int reached = run->entries->size(); // The earliest start: every entry from there on is in some tab
+	for (std::size_t i = 0; i < starts.size(); i++)
+		reached = std::min(reached, starts[i]);
+	for (; run->live < reached; run->live++)
+		release_entry(*run->first_live++);
+	if (starts.empty())
+	{
+		delete run->entries;
+		delete run;
+	}
+}
+
+// Fold the newest pieces of each tab that no other tab shares back into the tab's own list, so that pieces do not
+// pile up in a tab that outlives the tabs it was duplicated from
+void Browser::fold_runs()
+{
+	for (Tab &tab : tabs)
+	{
+		while (!tab.shared.empty() && tab.shared.back().run->starts.size() == 1)
+		{
+			SharedPiece piece = tab.shared.back();
+			SharedRun *run = piece.run;
+			HistoryList *entries = run->entries;
+			for (; run->live > 0; run->live--) // Entries before the tab's start, released when the other tabs left
+				entries->pop_front();
+			int moved = entries->size();
+			int position = -1; // Where current ends up in the folded list, if it is in the piece or the own entries
+			if (tab.piece + 1 == tab.shared.size())
+				position = tab.offset - piece.start;
+			else if (tab.piece == tab.shared.size())
+				position = moved + tab.history->position();
+
+			if (moved <= tab.history->size()) // Copy the smaller list into the larger, so no entry is copied often
+			{
+				for (HistoryList::const_iterator entry = entries->items().end(); entry != entries->items().begin();)
+					tab.history->push_front(*--entry);
+				delete entries;
+			}
+			else
+			{
+				for (url_id entry : tab.history->items())
+					entries->push_back(entry);
+				delete tab.history;
+				tab.history = entries;
+			}
+			tab.shared.pop_back();
+			tab.shared_count -= moved;
+			if (position >= 0)
+			{
+				tab.history->seek(position);
+				tab.piece = tab.shared.size();
+			}
+			delete run;
+		}
+	}
+	history = tabs[active].history;
+}
+
+// Take a history entry out of the ranking and drop its reference to the URL
+void Browser::release_entry(url_id id)
+{
+	ranking.left(id);
+	urls.release(id);
+}
+
+// Move current by steps in the current tab, through its own entries and the pieces before them
+void Browser::move_current(int steps)
+{
+	Tab &tab = tabs[active];
+	if (tab.shared.empty() || (tab.piece == tab.shared.size() && steps >= 0))
+	{
+		history->move(steps); // Own entries are the newest, so forward from them stays in them
+		return;
+	}
+	if (tab.piece == tab.shared.size()) // Back through the own entries, then into the newest piece
+	{
+		int before = history->position();
+		if (-steps <= before)
+		{
+			history->move(steps);
+			return;
+		}
+		steps += before + 1;
+		tab.piece--;
+		tab.at = tab.shared.back().run->entries->items().end();
+		--tab.at;
+		tab.offset = tab.shared.back().run->entries->size() - 1;
+	}
+	while (steps < 0) // Back through a piece, then into the one before it
+	{
+		int step = std::max(steps, tab.shared[tab.piece].start - tab.offset);
+		for (int i = step; i < 0; i++)
+			--tab.at;
+		tab.offset += step;
+		steps -= step;
+		if (steps == 0 || tab.piece == 0)
+			return;
+		tab.piece--;
+		tab.at = tab.shared[tab.piece].run->entries->items().end();
+		--tab.at;
+		tab.offset = tab.shared[tab.piece].run->entries->size() - 1;
+		steps++;
+	}
+	while (steps > 0) // Forward through a piece, then into the next one or the own entries
+	{
+		int step = std::min(steps, tab.shared[tab.piece].run->entries->size() - 1 - tab.offset);
+		for (int i = 0; i < step; i++)
+			++tab.at;
+		tab.offset += step;
+		steps -= step;
+		if (steps == 0)
+			return;
+		if (tab.piece + 1 < tab.shared.size())
+		{
+			tab.piece++;
+			tab.at = tab.shared[tab.piece].first;
+			tab.offset = tab.shared[tab.piece].start;
+			steps--;
+		}
+		else if (!history->empty())
+		{
+			tab.piece++;
+			history->begin();
+			history->move(steps - 1);
+			return;
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
+// Put current on the newest entry of the current tab
+void Browser::to_newest()
+{
+	Tab &tab = tabs[active];
+	history->end();
+	tab.piece = tab.shared.size();
+	if (history->empty() && !tab.shared.empty()) // Every entry is shared, so the newest is the last of a run
+	{
+		tab.piece--;
+		tab.at = tab.shared.back().run->entries->items().end();
+		--tab.at;
+		tab.offset = tab.shared.back().run->entries->size() - 1;
+	}
+}
+
+// Copy the shared entries of the current tab in front of its own, so they can be removed, and leave their runs
+void Browser::unshare_history()
+{
+	Tab &tab = tabs[active];
+	if (tab.shared.empty())
+		return;
+	for (std::size_t i = tab.shared.size(); i-- > 0;) // Newest first, as each goes on the front
+	{
+		const SharedPiece &piece = tab.shared[i];
+		for (HistoryList::const_iterator entry = piece.run->entries->items().end(); entry != piece.first;)
+		{
+			--entry;
+			history->push_front(*entry);
+			urls.retain(*entry);
+			ranking.copied(*entry);
+		}
+	}
+	for (std::size_t i = 0; i < tab.shared.size(); i++)
+		leave_run(tab.shared[i].run, tab.shared[i].start, -1);
+	tab.shared.clear();
+	tab.shared_count = 0;
+	tab.piece = 0;
+	history->end();
+	fold_runs();
+}
+
+// Release every entry of a tab and delete its list
+void Browser::release_tab(Tab &tab)
+{
+	for (url_id entry : tab.history->items())
+		release_entry(entry);
+	delete tab.history;
+	for (std::size_t i = 0; i < tab.shared.size(); i++)
+		leave_run(tab.shared[i].run, tab.shared[i].start, -1);
+}
+
 // Go back in the history by a number of steps
 void Browser::back(int steps)
 {
 	// If no steps to go back or the history is empty, return immediately
-	if (steps <= 0 || history->empty())
+	if (steps <= 0 || count_history() == 0)
 		return;
 
-	for (int i = 0; i < steps; i++)
-	{
-		// Stop if we reach the front of the list
-		if (history->get_current() == history->front())
-			break;
-		history->backward(); // Move current backward in the list
-	}
+	move_current(-steps); // Move current backward, stopping at the front of the list
+	if (journal != nullptr)
+		journal->record('<', steps);
 }
 
 // Go forward in the history by a number of steps
 void Browser::forward(int steps)
 {
 	// If no steps to go forward or the history is empty, return immediately
-	if (steps <= 0 || history->empty())
+	if (steps <= 0 || count_history() == 0)
 		return;
 
-	for (int i = 0; i < steps; i++)
-	{
-		// Stop if we reach the back of the list
-		if (history->get_current() == history->back())
-			break;
-		history->forward(); // Move current forward in the list
-	}
+	move_current(steps); // Move current forward, stopping at the back of the list
+	if (journal != nullptr)
+		journal->record('>', steps);
 }
 
 // Remove all instances of a URL from the history
-int Browser::remove(std::string url)
+int Browser::remove(std::string_view url)
 {
 	int count = 0;
-	// While the URL is found in history
-	while (history->search(url))
+	url_id id;
+	if (!tabs[active].shared.empty() && urls.find(url, id)) // Shared entries are not changed, so copy them first
+		unshare_history();
+	// While the URL is found in history (it cannot be if it is not in the URL table)
+	while (urls.find(url, id) && history->search(id))
 	{
 		// Remove current node
 		history->remove();
+		ranking.left(id);
+		urls.release(id);
 		count++; // Increment count of removed URLs
 	}
-	history->end(); // Reset current to the beginning of the list
+	to_newest(); // Reset current to the end of the list
+	if (journal != nullptr)
+		journal->record('r', url);
 	return count; // Return the number of removed URLs
 }
 
+// Remove every history entry matching any of the keys, in one pass
+std::vector<int> Browser::remove_many(const std::vector<std::string_view> &keys, RemoveMatch match)
+{
+	std::vector<int> counts(keys.size(), 0);
+	std::vector<int> matched;													 // Indexed by id: the key each URL matches, worked out the first time it is seen
+	int unseen = KEY_UNKNOWN;													 // What an id not in matched yet matches
+	std::unordered_map<std::string_view, int> numbers; // Each domain or prefix, with the number of its first appearance
+	std::vector<std::size_t> lengths;									 // Distinct prefix lengths, shortest first
+	if (match == REMOVE_URL) // Every URL that can match is already in the table, so look up the keys instead
+	{
+		for (std::size_t i = keys.size(); i-- > 0;) // Last to first, so a repeated key ends up with its first number
+		{
+			url_id id;
+			if (!urls.find(keys[i], id))
+				continue;
+			if (id >= matched.size())
+				matched.resize(id + 1, KEY_NONE);
+			matched[id] = static_cast<int>(i);
+		}
+		unseen = KEY_NONE;
+	}
+	else
+	{
+		numbers.reserve(keys.size());
+		for (std::size_t i = 0; i < keys.size(); i++)
+		{
+			if (numbers.emplace(keys[i], static_cast<int>(i)).second)
+				lengths.push_back(keys[i].size());
+		}
+		std::sort(lengths.begin(), lengths.end());
+		lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+	}
+	unshare_history(); // Shared entries are not changed, so copy them first
+	history->remove_if([&](url_id id)
+	{
+		if (id >= matched.size())
+			matched.resize(id + 1, unseen);
+		if (matched[id] == KEY_UNKNOWN)
+			matched[id] = match_key(urls.lookup(id), match, numbers, lengths);
+		if (matched[id] == KEY_NONE)
+			return false;
+		counts[matched[id]]++;
+		ranking.left(id);
+		urls.release(id); // Nothing is interned during the pass, so the id cannot be reused even if this drops it
+		return true;
+	});
+	history->end(); // Reset current to the end of the list, as remove does
+	if (journal != nullptr)
+		journal->record('R', static_cast<int>(match), keys);
+	return counts;
+}
+
+// Return up to k URLs from the history and bookmarks starting with prefix, the most common first
+std::vector<std::string_view> Browser::complete(std::string_view prefix, int k)
+{
+	std::vector<url_id> found;
+	urls.complete(prefix, k, found); // Every URL with a reference is in the history or bookmarks
+	std::vector<std::string_view> completions(found.size());
+	for (std::size_t i = 0; i < found.size(); i++)
+		completions[i] = urls.lookup(found[i]);
+	return completions;
+}
+
+// Return up to k sites with the most history entries, with their number of entries
+std::vector<std::pair<std::string_view, int> > Browser::most_visited(int k) const
+{
+	std::vector<RankedVisits> found;
+	ranking.top(k, found);
+	std::vector<std::pair<std::string_view, int> > sites(found.size());
+	for (std::size_t i = 0; i < found.size(); i++)
+		sites[i] = std::make_pair(std::string_view(urls.lookup(found[i].id)), found[i].visits);
+	return sites;
+}
+
 // Bookmark or unbookmark the current site
 void Browser::bookmark_current()
 {
-	std::string currentSite = get_current_site(); // Get the current site URL
+	url_id site = count_history() == 0 ? urls.intern(homepage) : current_id(tabs[active]); // Get the current site
+	const std::string &currentSite = urls.lookup(site);
 	// Search for the current site in the bookmarks to see if it's already bookmarked
-	if (bookmarks->search(currentSite))
+	if (is_bookmarked(site))
 	{
-		bookmarks->remove(); // Remove from bookmarks if already bookmarked
-		std::cout << "Removed " << currentSite << " from bookmarks." << std::endl;
+		bookmarks->search(site); // Only search when we know there is a match to remove
+		bookmarks->remove();		 // Remove from bookmarks if already bookmarked
+		bookmarked[site] = false;
+		*out << "Removed " << currentSite << " from bookmarks." << std::endl;
+		urls.release(site); // Only after printing, as this may drop the URL
 	}
 	else
 	{
-		bookmarks->push_back(currentSite); // Add to bookmarks if not already bookmarked
-		std::cout << "Added " << currentSite << " to bookmarks." << std::endl;
+		bookmarks->push_back(site); // Add to bookmarks if not already bookmarked
+		urls.retain(site);
+		if (site >= bookmarked.size())
+			bookmarked.resize(site + 1, false);
+		bookmarked[site] = true;
+		*out << "Added " << currentSite << " to bookmarks." << std::endl;
 	}
+	if (journal != nullptr)
+		journal->record('b');
 }
 
 // Clear all history and return to the homepage
 void Browser::clear_history()
 {
-	history->clear(); // Clear the history list
-	visit(homepage);	// Visit the homepage
+	Tab &tab = tabs[active];
+	for (url_id entry : history->items()) // Release every entry before the history forgets them
+	{
+		if (tabs.size() == 1)
+			urls.release(entry); // Every entry ranked is this tab's, so the ranking is cleared below in one go
+		else
+			release_entry(entry);
+	}
+	for (std::size_t i = 0; i < tab.shared.size(); i++)
+		leave_run(tab.shared[i].run, tab.shared[i].start, -1);
+	tab.shared.clear();
+	tab.shared_count = 0;
+	fold_runs();
+	history->clear();									// Clear the history list
+	if (tabs.size() == 1)
+		ranking.clear();
+	visit_id(urls.intern(homepage)); // Visit the homepage, recorded below as part of clearing
+	if (journal != nullptr)
+		journal->record('c');
 }
 
 // Print out all the bookmarks
@@ -127,20 +541,14 @@ void Browser::print_bookmarks()
 	// If the bookmarks list is empty
 	if (bookmarks->empty())
 	{
-		std::cout << "Bookmark list is empty." << std::endl;
+		*out << "Bookmark list is empty." << std::endl;
 	}
 	else
 	{
-		bookmarks->begin(); // Start at the first bookmark
-		std::cout << "Bookmark List:" << std::endl;
-		while (true)
+		*out << "Bookmark List:" << std::endl;
+		for (url_id site : bookmarks->items()) // Every bookmark in order, without moving the current pointer
 		{
-			std::cout << bookmarks->get_current() << std::endl; // Print the current bookmark
-			bookmarks->forward();																// Move to the next bookmark
-			if (bookmarks->get_current() == bookmarks->back())
-			{ // Check if we've reached the end
-				break;
-			}
+			*out << urls.lookup(site) << std::endl;
 		}
 	}
 }
@@ -148,7 +556,7 @@ void Browser::print_bookmarks()
 // Return the number of sites in the history
 int Browser::count_history() const
 {
-	return history->size(); // Return the size of the history list
+	return tabs[active].shared_count + history->size(); // Return the size of the history list, with its shared entries
 }
 
 // Return the number of bookmarks
@@ -160,16 +568,120 @@ int Browser::count_bookmarks() const
 // Visit a bookmark at a given index
 void Browser::visit_bookmark(int index)
 {
-	bookmarks->begin(); // Start at the first bookmark
-	for (int i = 0; i < index; i++)
+	// Jump straight to the bookmark; if the index is out of bounds, print an error and return
+	if (!bookmarks->seek(index))
 	{
-		// If the index is out of bounds, print an error and return
-		if (bookmarks->get_current() == bookmarks->back())
+		*out << "Invalid index." << std::endl;
+		return;
+	}
+	visit_id(bookmarks->get_current()); // Visit the bookmark at the given index
+	if (journal != nullptr)
+		journal->record('V', index);
+}
+
+// Open a new tab on the homepage and switch to it
+void Browser::new_tab()
+{
+	Tab tab = { std::vector<SharedPiece>(), 0, new HistoryList(), 0, HistoryList::const_iterator(), 0 };
+	tabs.push_back(tab);
+	active = tabs.size() - 1;
+	history = tab.history;
+	visit_id(urls.intern(homepage)); // Start with the homepage in the history, recorded below as part of opening
+	if (journal != nullptr)
+		journal->record('n');
+}
+
+// Open a copy of the current tab after it, sharing its history, and switch to it
+void Browser::duplicate_tab()
+{
+	Tab &tab = tabs[active];
+	if (!history->empty()) // Hand the tab's own entries over to a run, which both tabs then share
+	{
+		SharedRun *run = new SharedRun;
+		run->entries = history;
+		run->live = 0;
+		run->first_live = history->items().begin();
+		run->starts.push_back(0);
+		if (tab.piece == tab.shared.size()) // Current is one of the entries handed over
 		{
-			std::cout << "Invalid index." << std::endl;
-			return;
+			tab.at = history->at_current();
+			tab.offset = history->position();
 		}
-		bookmarks->forward(); // Move to the next bookmark
+		SharedPiece piece = { run, 0, run->first_live };
+		tab.shared.push_back(piece);
+		tab.shared_count += history->size();
+		tab.history = history = new HistoryList();
+	}
+
+	Tab copy = tab; // Only the pieces are copied, not what they hold
+	copy.history = new HistoryList();
+	for (std::size_t i = 0; i < copy.shared.size(); i++)
+		copy.shared[i].run->starts.push_back(copy.shared[i].start);
+	tabs.insert(tabs.begin() + active + 1, copy);
+	active++;
+	history = copy.history;
+	if (journal != nullptr)
+		journal->record('d');
+}
+
+// Close the current tab, unless it is the only one
+void Browser::close_tab()
+{
+	if (tabs.size() == 1)
+	{
+		*out << "Cannot close the only tab." << std::endl;
+		return;
 	}
-	visit(bookmarks->get_current()); // Visit the bookmark at the given index
+	release_tab(tabs[active]);
+	tabs.erase(tabs.begin() + active);
+	if (active == tabs.size())
+		active--;
+	history = tabs[active].history;
+	fold_runs();
+	if (journal != nullptr)
+		journal->record('x');
+}
+
+// Switch to the tab at a given index
+void Browser::switch_tab(int index)
+{
+	if (index < 0 || index >= count_tabs())
+	{
+		*out << "Invalid index." << std::endl;
+		return;
+	}
+	active = static_cast<std::size_t>(index);
+	history = tabs[active].history;
+	if (journal != nullptr)
+		journal->record('w', index);
+}
+
+// Print every tab with its current site
+void Browser::print_tabs()
+{
+	*out << "Tab List:" << std::endl;
+	for (std::size_t i = 0; i < tabs.size(); i++)
+	{
+		const Tab &tab = tabs[i];
+		bool empty = tab.shared_count == 0 && tab.history->empty();
+		*out << i << ". " << (empty ? homepage : urls.lookup(current_id(tab))) << (i == active ? " (current)" : "") << std::endl;
+	}
+}
+
+// Return the number of tabs
+int Browser::count_tabs() const
+{
+	return static_cast<int>(tabs.size());
+}
+
+// Return the index of the current tab
+int Browser::current_tab() const
+{
+	return static_cast<int>(active);
+}
+
+// Check whether a URL is bookmarked
+bool Browser::is_bookmarked(url_id url) const
+{
+	return url < bookmarked.size() && bookmarked[url];
 }
\ No newline at end of file
@@ -11,9 +11,39 @@
 #define SENG1120_BROWSER_H 
 
 #include "linked_list.h"
+#include "circular_buffer.h"
+#include "unrolled_list.h"
+#include "url_table.h"
+#include "visit_ranking.h"
 #include <string>
+#include <string_view>
+#include <vector>
 #include <iostream>
 
+class BrowserJournal;
+
+// Both lists store ids from the browser's UrlTable. The history is indexed by id, so search (and with it remove)
+// does not scan the list, and unchecked, as the Browser tests every call for an entry before making it and so never
+// relies on the list throwing. Building with -DBROWSER_RING_HISTORY stores the history in a CircularBuffer sized to
+// the history limit instead, and -DBROWSER_UNROLLED_HISTORY stores it in an UnrolledList of small chunks.
+// Bookmarks are kept in a CircularBuffer, so visit_bookmark can jump straight to an index.
+#if defined(BROWSER_RING_HISTORY)
+typedef CircularBuffer<url_id> HistoryList;
+#elif defined(BROWSER_UNROLLED_HISTORY)
+typedef UnrolledList<url_id> HistoryList;
+#else
+typedef LinkedList<url_id, NodePool<url_id>, HashIndex<url_id>, UncheckedAccess> HistoryList;
+#endif
+typedef CircularBuffer<url_id> BookmarkList;
+
+// How remove_many matches a history entry against its keys
+enum RemoveMatch
+{
+    REMOVE_URL,           // the entry is the key
+    REMOVE_DOMAIN,        // the host of the entry is the key or a subdomain of it: example.com matches www.example.com/a
+    REMOVE_PREFIX         // the entry starts with the key
+};
+
 class Browser 
 {
 public:
@@ -21,11 +51,20 @@ public:
      * Initializes the browser with a homepage, defaulting to newcastle.edu.au. 
      * Sets a limit for the number of entries in the history.
      * 
-     * Precondition:  None  
+     * Precondition:  history_limit is at least 1.
      * Postcondition: All required variables are initialised, with the homepage added to the history.
      */ 
     Browser(const std::string& homepage = "newcastle.edu.au", int history_limit = 10);
 
+    /**
+     * Initializes the browser as above, with everything it prints (bookmark changes and lists) written to out
+     * instead of std::cout.
+     *
+     * Precondition:  out outlives the browser, and history_limit is at least 1.
+     * Postcondition: All required variables are initialised, with the homepage added to the history.
+     */
+    explicit Browser(std::ostream& out, const std::string& homepage = "newcastle.edu.au", int history_limit = 10);
+
     /**
      * Destructor for a Browser object.
      * 
@@ -51,7 +90,7 @@ public:
      * Precondition:   url is a valid string, with no spaces.    
      * Postcondition:  The current site is updated to url, with no forward history. The oldest history element is removed if the history limit is exceeded.
      */ 
-    void visit(const std::string& url);
+    void visit(std::string_view url);
 
     /**
      * Move back (toward the tail) in history by the specified number of steps. 
@@ -83,7 +122,41 @@ public:
      * Current should point to the last (tail) element in the history. 
      * The number of elements deleted is returned.
      */ 
-    int remove(std::string url);
+    int remove(std::string_view url);
+
+    /**
+     * Remove every history entry that matches any of the keys, as match says, in a single pass over the history
+     * however many keys there are. Each distinct URL in the history is matched against the keys only once,
+     * by hashing rather than by comparing it with every key.
+     * An entry is counted against the most specific key it matches (the longest domain or prefix), and a key
+     * that appears twice is counted at its first appearance.
+     *
+     * Precondition:  None
+     * Postcondition: Every matching entry is deleted from the history, and the number deleted for each key is
+     *                returned in the order of keys. Current points to the last element in the history, as for remove.
+     */
+    std::vector<int> remove_many(const std::vector<std::string_view>& keys, RemoveMatch match);
+
+    /**
+     * Return up to k URLs from the history and bookmarks that start with prefix, for autocompletion. URLs that
+     * appear more often (counting each history entry, and a bookmark once) come first, with ties in alphabetical
+     * order. This is answered from a radix tree kept up to date by every change to either list, so it takes
+     * microseconds however long the history is.
+     *
+     * Precondition:  None
+     * Postcondition: The URLs are returned as views into the browser, valid until the browser next changes.
+     */
+    std::vector<std::string_view> complete(std::string_view prefix, int k);
+
+    /**
+     * Return up to k sites with the most entries in the history, with the number of entries each has, the most
+     * recently visited first among sites with as many. This is read from a ranking kept up to date as entries
+     * are added and removed, so it does not scan the history.
+     *
+     * Precondition:  None
+     * Postcondition: The sites are returned as views into the browser, valid until the browser next changes.
+     */
+    std::vector<std::pair<std::string_view, int> > most_visited(int k) const;
 
     /**
      * Bookmark the current page. 
@@ -104,10 +177,10 @@ public:
 
     /**
      * Prints the bookmark list, in the order they were added (i.e., oldest entry first), one entry per line.
-     * The current pointer of the bookmark list should be the first (head) element. If no elements are present, prints 'Bookmark list is empty.'
+     * No changes have been made to the class. If no elements are present, prints 'Bookmark list is empty.'
      * 
      * Precondition:   None
-     * Postcondition:  The bookmark list pointer is modified to point to the first (head) element in the list.  
+     * Postcondition:  No changes have been made to the class.
      */ 
     void print_bookmarks();
 
@@ -136,12 +209,145 @@ public:
      * Postcondition: The element at the specified index in the bookmark list is visited, otherwise an error message is printed.
      */ 
     void visit_bookmark(int index);
+
+    /**
+     * Open a new tab on the homepage and switch to it. Each tab has its own history and current site, and every
+     * other call works on the current tab; the bookmarks are shared by all of them.
+     *
+     * Precondition:  None
+     * Postcondition: A new tab, after the others, is the current tab, with only the homepage in its history.
+     */
+    void new_tab();
+
+    /**
+     * Open a copy of the current tab just after it and switch to it. The two tabs share the history they have
+     * in common rather than each having a copy, so this takes the same time and memory however long the history
+     * is, and only what is visited in either tab afterwards takes room of its own. What it does copy is one
+     * pointer for each run of history the tab shares, and a tab gains a run each time it is duplicated after
+     * visiting somewhere new.
+     *
+     * Precondition:  None
+     * Postcondition: The new tab is the current tab, with the same history and current site as the one copied.
+     */
+    void duplicate_tab();
+
+    /**
+     * Close the current tab and switch to the tab that took its place, or to the one before it if it was last.
+     * If it is the only tab, it should print an error message of 'Cannot close the only tab.'
+     *
+     * Precondition:  None
+     * Postcondition: The current tab is closed and its history released, unless it was the only one.
+     */
+    void close_tab();
+
+    /**
+     * Switch to the tab at the specified index.
+     * If the index is not valid, it should print an error message of 'Invalid index.'
+     *
+     * Precondition:  None
+     * Postcondition: The tab at index is the current tab, otherwise an error message is printed.
+     */
+    void switch_tab(int index);
+
+    /**
+     * Prints every tab in order with its index and current site, one per line, marking the current tab.
+     *
+     * Precondition:  None
+     * Postcondition: No changes have been made to the class.
+     */
+    void print_tabs();
+
+    /**
+     * Return the number of open tabs.
+     *
+     * Precondition:  None
+     * Postcondition: No changes have been made to the class.
+     */
+    int count_tabs() const;
+
+    /**
+     * Return the index of the current tab.
+     *
+     * Precondition:  None
+     * Postcondition: No changes have been made to the class.
+     */
+    int current_tab() const;
 private:
-    LinkedList<std::string>* history;     // linked list of history entries, with the most recently visited site at the end (tail) of the list
-    LinkedList<std::string>* bookmarks;   // linked list of bookmarks
+    friend class BrowserSnapshot;         // Saves and restores the whole state; see snapshot.h
+    friend class BrowserJournal;          // Records every change; see journal.h
+
+    /**
+     * Visit an interned URL, as visit does.
+     *
+     * Precondition:  url was returned by the URL table of this browser.
+     * Postcondition: As for visit.
+     */
+    void visit_id(url_id url);
+
+    /**
+     * Return true if the supplied URL is in the bookmark list, without searching it.
+     *
+     * Precondition:  url was returned by the URL table of this browser.
+     * Postcondition: No changes have been made to the class.
+     */
+    bool is_bookmarked(url_id url) const;
+
+    // A run of history entries shared by tabs. Duplicating a tab freezes the entries the tab has of its own into
+    // a run, by handing over the list rather than copying it, and both tabs then refer to the run from where
+    // their histories start in it. A run is never changed while it is shared: a tab that evicts an entry of a
+    // run only moves its start along, and a tab that removes entries (remove, remove_many) first copies its
+    // shared entries into a list of its own. Each entry of a run is counted once by the URL table and the
+    // ranking, however many tabs share it, and is released once every tab that refers to the run starts past it.
+    // A run left with one tab is folded back into that tab's own list while it is the tab's newest piece.
+    struct SharedRun
+    {
+        HistoryList* entries;               // oldest first; never changed once frozen
+        std::vector<int> starts;            // where each tab referring to the run starts in it
+        int live;                           // entries before this are in no tab, and have been released
+        HistoryList::const_iterator first_live; // the entry at live
+    };
+
+    // The part of a tab's history held in a run: the entries of run from start on
+    struct SharedPiece
+    {
+        SharedRun* run;
+        int start;
+        HistoryList::const_iterator first;  // the entry at start
+    };
+
+    // One tab: the runs it shares, oldest first, followed by the newer entries it has of its own
+    struct Tab
+    {
+        std::vector<SharedPiece> shared;
+        int shared_count;                   // number of entries in the pieces
+        HistoryList* history;               // the tab's own entries, with current on the right one while in them
+        std::size_t piece;                  // the piece current is in, or shared.size() while it is in history
+        HistoryList::const_iterator at;     // current, while it is in a piece
+        int offset;                         // index of at within its run
+    };
+
+    url_id current_id(const Tab& tab) const; // Current entry of tab, whose history must not be empty
+    void to_newest();                     // Put current on the newest entry of the current tab
+    void evict_oldest();                  // Remove the oldest entry of the current tab, releasing it
+    void move_current(int steps);         // Move current across the pieces and own list, as move does
+    void unshare_history();               // Copy the shared entries of the current tab into its own list
+    void release_tab(Tab& tab);           // Release every entry of tab and delete its list
+    void leave_run(SharedRun* run, int start, int moved); // Move a start in run to moved, or drop it if -1
+    void fold_runs();                     // Fold the newest pieces no other tab shares into each tab's own list
+    void release_entry(url_id id);        // Tell the ranking and URL table that a history entry has gone
+
+    UrlTable urls;                        // every URL seen by this browser, shared by the history and bookmarks
+    std::vector<Tab> tabs;                // every open tab, in order
+    std::size_t active;                   // index of the current tab
+    HistoryList* history;                 // the current tab's own history entries (tabs[active].history), with the most recently visited site at the end (tail) of the list
+    BookmarkList* bookmarks;              // linked list of bookmarks
+    std::vector<bool> bookmarked;         // indexed by url_id; a bookmarked URL holds a reference, so its id is never reused
+    VisitRanking ranking;                 // every URL in a history, ranked by its number of entries
 
     int history_limit;                    // the maximum number of elements in the history
     std::string homepage;                 // the homepage of the browser
+    std::ostream* out;                    // where the browser prints, std::cout unless another stream was supplied
+    BrowserJournal* journal;              // records each change once it is made, or null when not journaled
 };
 
 #endif
\ No newline at end of file
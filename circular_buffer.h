@@ -0,0 +1,308 @@
+/*
+* circular_buffer.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a templated circular buffer that offers the same interface as LinkedList.
+* Elements are stored contiguously and the current position is held as an index, so a buffer that is
+* created with enough capacity never allocates when elements are pushed and popped.
+*
+* Positions mirror the sentinel nodes of LinkedList: index -1 plays the role of head and index size()
+* plays the role of tail.
+*/
+
+#ifndef SENG1120_CIRCULAR_BUFFER_H
+#define SENG1120_CIRCULAR_BUFFER_H
+
+#include "empty_collection_exception.h"
+#include "item_range.h"
+#include "stats.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+template <typename T>
+class CircularBuffer
+{
+public:
+
+    /*
+    * A bidirectional iterator over the elements, first to last, as for LinkedList. It stays valid until an
+    * element is added or removed, as that can move the elements along.
+    */
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const T*, T*>::type pointer;
+        typedef typename std::conditional<Const, const T&, T&>::type reference;
+
+        Iterator() : buffer(nullptr), index(0) {}
+        Iterator(const Iterator<false>& other) : buffer(other.buffer), index(other.index) {}   // So an iterator converts to a const_iterator
+
+        reference operator*() const { return buffer->at(index); }
+        pointer operator->() const { return &buffer->at(index); }
+        Iterator& operator++() { index++; return *this; }
+        Iterator operator++(int) { Iterator was = *this; index++; return was; }
+        Iterator& operator--() { index--; return *this; }
+        Iterator operator--(int) { Iterator was = *this; index--; return was; }
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+
+    private:
+        friend class CircularBuffer;
+        template <bool> friend class Iterator;
+
+        Iterator(const CircularBuffer* buffer, int index) : buffer(buffer), index(index) {}
+
+        const CircularBuffer* buffer;
+        int index;                  // Logical index of the element
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A new, empty buffer is created with room for capacity elements.
+    */
+    CircularBuffer(int capacity = 16);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The buffer is destroyed and all associated memory is freed.
+    */
+    ~CircularBuffer();
+
+    /*
+    * The supplied data is inserted at the front of the buffer. The buffer grows if it is full.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated.
+    */
+    void push_front(const T& data);
+
+    /*
+    * The supplied data is moved into the front of the buffer. The buffer grows if it is full.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_front(T&& data);
+
+    /*
+    * A data item is constructed from args and moved into the front of the buffer, as slots are always constructed.
+    *
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The first data item is updated.
+    */
+    template <typename... Args>
+    void emplace_front(Args&&... args);
+
+    /*
+    * The supplied data is inserted at the end of the buffer. The buffer grows if it is full.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated.
+    */
+    void push_back(const T& data);
+
+    /*
+    * The supplied data is moved into the end of the buffer. The buffer grows if it is full.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_back(T&& data);
+
+    /*
+    * A data item is constructed from args and moved into the end of the buffer, as slots are always constructed.
+    *
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The last data item is updated.
+    */
+    template <typename... Args>
+    void emplace_back(Args&&... args);
+
+    /*
+    * The supplied data is inserted after the current element, shifting the later elements along.
+    *
+    * Precondition:    Current is not past the last element.
+    * Postcondition:   A new element has been added after current.
+    */
+    void insert(const T& data);
+
+    /*
+    * Remove the first data element. An exception is thrown if the buffer is empty.
+    *
+    * Precondition:    The buffer is not empty.
+    * Postcondition:   The first data element has been removed and returned.
+    */
+    T pop_front();
+
+    /*
+    * Remove the last data element. An exception is thrown if the buffer is empty.
+    *
+    * Precondition:    The buffer is not empty.
+    * Postcondition:   The last data element has been removed and returned.
+    */
+    T pop_back();
+
+    /*
+    * Remove the current element, shifting the later elements back. An exception is thrown if the buffer
+    * is empty or current is not on an element.
+    *
+    * Precondition:    The buffer is not empty and current is on an element.
+    * Postcondition:   The current element has been removed and returned. Current is on the element that followed it.
+    */
+    T remove();
+
+    /*
+    * Remove every data element for which pred returns true, moving each kept element straight to its final slot,
+    * so this costs O(size()) however many are removed. pred is called exactly once for each element, in order.
+    *
+    * Precondition:    pred can be called with a const T& and returns a value convertible to bool.
+    * Postcondition:   The matching elements have been removed and their number is returned. Current stays on its
+    *                  element if that was kept, and otherwise is before the first element.
+    */
+    template <typename Predicate>
+    int remove_if(Predicate pred);
+
+    /*
+    * Clears all data elements. The storage is kept for reuse.
+    *
+    * Precondition:    None
+    * Postcondition:   The buffer is empty and current is before the first element.
+    */
+    void clear();
+
+    /*
+    * Make sure that capacity elements fit without the buffer having to grow.
+    *
+    * Precondition:    None
+    * Postcondition:   The buffer can hold at least capacity elements without allocating.
+    */
+    void reserve(int capacity);
+
+    /*
+    * Precondition:    The buffer is not empty.
+    * Postcondition:   A reference to the first data element is returned.
+    */
+    T& front() const;
+
+    /*
+    * Precondition:    The buffer is not empty.
+    * Postcondition:   A reference to the last data element is returned.
+    */
+    T& back() const;
+
+    /*
+    * Precondition:    The buffer is not empty and current is on an element.
+    * Postcondition:   A reference to the current data element is returned.
+    */
+    T& get_current() const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current is on the first element (or past the end, if the buffer is empty).
+    */
+    void begin();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current is on the last element (or before the start, if the buffer is empty).
+    */
+    void end();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current moves to the next element, unless it is already on the last one.
+    */
+    void forward();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current moves to the previous element, unless it is already on the first one.
+    */
+    void backward();
+
+    /*
+    * Move current by the given number of elements: forward if steps is positive, backward if it is negative.
+    * Movement stops at the first or last element, exactly as repeated calls to forward or backward would, in O(1).
+    *
+    * Precondition:    None
+    * Postcondition:   Current has moved by at most |steps| elements and the signed distance moved is returned.
+    */
+    int move(int steps);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The index of the current element is returned, with -1 before the first and size() past the last.
+    */
+    int position() const;
+
+    /*
+    * Move current directly to the element at the supplied index, in O(1).
+    *
+    * Precondition:    None
+    * Postcondition:   If 0 <= index < size(), current is on that element and true is returned. Otherwise nothing changes.
+    */
+    bool seek(int index);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   current is on the first element equal to target and true is returned; otherwise nothing changes.
+    */
+    bool search(const T& target);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The number of elements is returned.
+    */
+    int size() const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    bool empty() const;
+
+    /*
+    * Return iterators over every element, first to last, as for LinkedList.
+    *
+    * Precondition:    None
+    * Postcondition:   A range over every element is returned. Nothing in the buffer changes.
+    */
+    ItemRange<iterator> items();
+    ItemRange<const_iterator> items() const;
+
+    /*
+    * Return an iterator to the current element, as for LinkedList.
+    *
+    * Precondition:    The buffer is not empty and current is on an element.
+    * Postcondition:   An iterator to the current element is returned. Nothing in the buffer changes.
+    */
+    const_iterator at_current() const;
+
+private:
+    CircularBuffer(const CircularBuffer<T>&);              // Not copyable
+    CircularBuffer<T>& operator=(const CircularBuffer<T>&);
+
+    T& at(int index) const;         // Element at a logical index, wrapping around the storage
+    T& open_front();                // Make room for a new first element and return its slot
+    T& open_back();                 // Make room for a new last element and return its slot
+    void grow();                    // Double the capacity, keeping the elements in order
+
+    T* slots;                       // Storage for capacity elements
+    int capacity;                   // Number of slots
+    int start;                      // Slot holding the first element
+    int count;                      // Number of elements
+    int current;                    // Logical index of the current element; -1 and count are the sentinel positions
+};
+
+#include "circular_buffer.hpp"
+
+#endif
@@ -0,0 +1,431 @@
+/*
+ * circular_buffer.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include <utility>
+
+// Constructor for CircularBuffer
+// Precondition:   None
+// Postcondition:  A new, empty buffer is created with room for capacity elements.
+template <typename T>
+CircularBuffer<T>::CircularBuffer(int capacity)
+		: slots(nullptr), capacity(capacity > 0 ? capacity : 1), start(0), count(0), current(-1)
+{
+	slots = new T[this->capacity]; // Allocate all the storage up front
+}
+
+// Destructor for CircularBuffer
+// Precondition:   None
+// Postcondition:  The buffer is destroyed and all associated memory is freed.
+template <typename T>
+CircularBuffer<T>::~CircularBuffer()
+{
+	delete[] slots;
+}
+
+// Return the element at a logical index, wrapping around the end of the storage
+template <typename T>
+T &CircularBuffer<T>::at(int index) const
+{
+	int slot = start + index;
+	if (slot >= capacity) // Wrap around without a division
+		slot -= capacity;
+	return slots[slot];
+}
+
+// Double the capacity, moving the elements so that the first one is in slot 0
+template <typename T>
+void CircularBuffer<T>::grow()
+{
+	int new_capacity = capacity * 2;
+	T *new_slots = new T[new_capacity];
+	for (int i = 0; i < count; i++)
+		new_slots[i] = std::move(at(i));
+	delete[] slots;
+	slots = new_slots;
+	capacity = new_capacity;
+	start = 0;
+}
+
+// Make sure that capacity elements fit without growing
+// Precondition:   None
+// Postcondition:  The buffer can hold at least capacity elements without allocating.
+template <typename T>
+void CircularBuffer<T>::reserve(int capacity)
+{
+	while (this->capacity < capacity)
+		grow();
+}
+
+// Make room for a new first element and return its slot
+template <typename T>
+T &CircularBuffer<T>::open_front()
+{
+	if (count == capacity) // No free slot, so grow first
+		grow();
+	start = (start == 0 ? capacity : start) - 1; // Step the start back one slot
+	count++;
+	if (current >= 0) // Every element moved up one position
+		current++;
+	return slots[start];
+}
+
+// Make room for a new last element and return its slot
+template <typename T>
+T &CircularBuffer<T>::open_back()
+{
+	if (count == capacity) // No free slot, so grow first
+		grow();
+	if (current == count) // Stay past the end, as the tail sentinel would
+		current++;
+	count++;
+	return at(count - 1);
+}
+
+// Insert data at the front of the buffer
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated.
+template <typename T>
+void CircularBuffer<T>::push_front(const T &data)
+{
+	open_front() = data;
+}
+
+// Move data into the front of the buffer
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated and data has been moved from.
+template <typename T>
+void CircularBuffer<T>::push_front(T &&data)
+{
+	open_front() = std::move(data);
+}
+
+// Construct a data element and move it into the front of the buffer
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The first data item is updated.
+template <typename T>
+template <typename... Args>
+void CircularBuffer<T>::emplace_front(Args &&...args)
+{
+	open_front() = T(std::forward<Args>(args)...);
+}
+
+// Insert data at the end of the buffer
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated.
+template <typename T>
+void CircularBuffer<T>::push_back(const T &data)
+{
+	open_back() = data;
+}
+
+// Move data into the end of the buffer
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated and data has been moved from.
+template <typename T>
+void CircularBuffer<T>::push_back(T &&data)
+{
+	open_back() = std::move(data);
+}
+
+// Construct a data element and move it into the end of the buffer
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The last data item is updated.
+template <typename T>
+template <typename... Args>
+void CircularBuffer<T>::emplace_back(Args &&...args)
+{
+	open_back() = T(std::forward<Args>(args)...);
+}
+
+// Insert data after the current element
+// Precondition:   Current is not past the last element.
+// Postcondition:  A new element has been added after current.
+template <typename T>
+void CircularBuffer<T>::insert(const T &data)
+{
+	if (current >= count) // If current is past the end, do nothing
+		return;
+	if (count == capacity)
+		grow();
+	int position = current + 1;
+	for (int i = count; i > position; i--) // Shift the later elements along
+		at(i) = std::move(at(i - 1));
+	at(position) = data;
+	count++;
+}
+
+// Remove the first data element
+// Precondition:   The buffer is not empty.
+// Postcondition:  The first data element has been removed and returned.
+template <typename T>
+T CircularBuffer<T>::pop_front()
+{
+	if (empty()) // If buffer is empty, throw exception
+		throw empty_collection_exception();
+	T data = std::move(slots[start]);
+	start = (start + 1 == capacity ? 0 : start + 1);
+	count--;
+	if (current >= 0) // Every element moved down one position; the first one becomes the head position
+		current--;
+	return data;
+}
+
+// Remove the last data element
+// Precondition:   The buffer is not empty.
+// Postcondition:  The last data element has been removed and returned.
+template <typename T>
+T CircularBuffer<T>::pop_back()
+{
+	if (empty()) // If buffer is empty, throw exception
+		throw empty_collection_exception();
+	count--;
+	T data = std::move(at(count));
+	if (current == count) // The current element was removed
+		current = -1;
+	else if (current == count + 1) // Stay past the end
+		current = count;
+	return data;
+}
+
+// Remove the current element
+// Precondition:   The buffer is not empty and current is on an element.
+// Postcondition:  The current element has been removed and returned. Current is on the element that followed it.
+template <typename T>
+T CircularBuffer<T>::remove()
+{
+	if (empty() || current < 0 || current >= count) // If buffer is empty or current is not on an element, throw exception
+		throw empty_collection_exception();
+	T data = std::move(at(current));
+	if (current < count / 2) // Closer to the front, so shift the earlier elements up
+	{
+		for (int i = current; i > 0; i--)
+			at(i) = std::move(at(i - 1));
+		start = (start + 1 == capacity ? 0 : start + 1);
+	}
+	else // Closer to the back, so shift the later elements down
+	{
+		for (int i = current; i < count - 1; i++)
+			at(i) = std::move(at(i + 1));
+	}
+	count--; // Current now indexes the element that followed the removed one
+	return data;
+}
+
+// Remove every data element for which pred returns true, compacting the kept ones in one pass
+// Precondition:   pred can be called with a const T& and returns a value convertible to bool.
+// Postcondition:  The matching elements have been removed and their number is returned. Current stays on its element if that was kept, and otherwise is before the first element.
+template <typename T>
+template <typename Predicate>
+int CircularBuffer<T>::remove_if(Predicate pred)
+{
+	int kept = 0;
+	int new_current = (current >= count ? -2 : -1); // -2 marks a current past the end
+	for (int i = 0; i < count; i++)
+	{
+		if (pred(static_cast<const T &>(at(i))))
+			continue;
+		if (kept != i) // Move the element down over the removed ones
+			at(kept) = std::move(at(i));
+		if (current == i)
+			new_current = kept;
+		kept++;
+	}
+	for (int i = kept; i < count; i++)
+		at(i) = T(); // Release whatever the vacated slots own
+	int removed = count - kept;
+	count = kept;
+	current = (new_current == -2 ? count : new_current);
+	return removed;
+}
+
+// Clear all data elements, keeping the storage
+// Precondition:   None
+// Postcondition:  The buffer is empty and current is before the first element.
+template <typename T>
+void CircularBuffer<T>::clear()
+{
+	for (int i = 0; i < count; i++)
+		at(i) = T(); // Release whatever the elements own
+	start = 0;
+	count = 0;
+	current = -1;
+}
+
+// Return a reference to the first data element
+// Precondition:   The buffer is not empty.
+// Postcondition:  A reference to the first data element is returned.
+template <typename T>
+T &CircularBuffer<T>::front() const
+{
+	if (empty()) // If buffer is empty, throw exception
+		throw empty_collection_exception();
+	return slots[start];
+}
+
+// Return a reference to the last data element
+// Precondition:   The buffer is not empty.
+// Postcondition:  A reference to the last data element is returned.
+template <typename T>
+T &CircularBuffer<T>::back() const
+{
+	if (empty()) // If buffer is empty, throw exception
+		throw empty_collection_exception();
+	return at(count - 1);
+}
+
+// Return a reference to the current data element
+// Precondition:   The buffer is not empty and current is on an element.
+// Postcondition:  A reference to the current data element is returned.
+template <typename T>
+T &CircularBuffer<T>::get_current() const
+{
+	if (empty() || current < 0 || current >= count) // If buffer is empty or current is not on an element, throw exception
+		throw empty_collection_exception();
+	return at(current);
+}
+
+// Move current to the first element
+// Precondition:   None
+// Postcondition:  Current is on the first element (or past the end, if the buffer is empty).
+template <typename T>
+void CircularBuffer<T>::begin()
+{
+	current = 0;
+}
+
+// Move current to the last element
+// Precondition:   None
+// Postcondition:  Current is on the last element (or before the start, if the buffer is empty).
+template <typename T>
+void CircularBuffer<T>::end()
+{
+	current = count - 1;
+}
+
+// Move current to the next element, unless it is already on the last one
+// Precondition:   None
+// Postcondition:  Current moves to the next element, if applicable.
+template <typename T>
+void CircularBuffer<T>::forward()
+{
+	if (current < count - 1)
+		current++;
+}
+
+// Move current to the previous element, unless it is already on the first one
+// Precondition:   None
+// Postcondition:  Current moves to the previous element, if applicable.
+template <typename T>
+void CircularBuffer<T>::backward()
+{
+	if (current > 0)
+		current--;
+}
+
+// Move current by the given number of elements, stopping at the first or last one
+// Precondition:   None
+// Postcondition:  Current has moved by at most |steps| elements and the signed distance moved is returned.
+template <typename T>
+int CircularBuffer<T>::move(int steps)
+{
+	int target = current;
+	if (steps > 0 && current < count - 1) // Forward never goes past the last element
+		target = (steps >= count - 1 - current) ? count - 1 : current + steps;
+	else if (steps < 0 && current > 0) // Backward never goes before the first element
+		target = (steps <= -current) ? 0 : current + steps;
+	int moved = target - current;
+	current = target;
+	return moved;
+}
+
+// Return the index of the current element
+// Precondition:   None
+// Postcondition:  The index of the current element is returned, with -1 before the first and size() past the last.
+template <typename T>
+int CircularBuffer<T>::position() const
+{
+	return current;
+}
+
+// Move current directly to the element at index
+// Precondition:   None
+// Postcondition:  If 0 <= index < size(), current is on that element and true is returned. Otherwise nothing changes.
+template <typename T>
+bool CircularBuffer<T>::seek(int index)
+{
+	if (index < 0 || index >= count)
+		return false;
+	current = index;
+	return true;
+}
+
+// Move current to the first element equal to target
+// Precondition:   None
+// Postcondition:  current is on the first element equal to target and true is returned; otherwise nothing changes.
+template <typename T>
+bool CircularBuffer<T>::search(const T &target)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (at(i) == target)
+		{
+			current = i;
+			BROWSER_STAT(STAT_SEARCHES, 1);
+			BROWSER_STAT(STAT_SEARCH_COMPARISONS, i + 1);
+			return true;
+		}
+	}
+	BROWSER_STAT(STAT_SEARCHES, 1);
+	BROWSER_STAT(STAT_SEARCH_COMPARISONS, count);
+	return false;
+}
+
+// Return the number of elements
+// Precondition:   None
+// Postcondition:  The number of elements is returned.
+template <typename T>
+int CircularBuffer<T>::size() const
+{
+	return count;
+}
+
+// Return true if the buffer is empty, false otherwise
+// Precondition:   None
+// Postcondition:  None
+template <typename T>
+bool CircularBuffer<T>::empty() const
+{
+	return count == 0;
+}
+
+// Return iterators from the first element to past the last
+// Precondition:   None
+// Postcondition:  A range over every element is returned.
+template <typename T>
+ItemRange<typename CircularBuffer<T>::iterator> CircularBuffer<T>::items()
+{
+	return ItemRange<iterator>(iterator(this, 0), iterator(this, count));
+}
+
+// Return const iterators from the first element to past the last
+// Precondition:   None
+// Postcondition:  A range over every element is returned.
+template <typename T>
+ItemRange<typename CircularBuffer<T>::const_iterator> CircularBuffer<T>::items() const
+{
+	return ItemRange<const_iterator>(const_iterator(this, 0), const_iterator(this, count));
+}
+
+// Return an iterator to the current element
+// Precondition:   The buffer is not empty and current is on an element.
+// Postcondition:  An iterator to the current element is returned.
+template <typename T>
+typename CircularBuffer<T>::const_iterator CircularBuffer<T>::at_current() const
+{
+	if (empty() || current < 0 || current >= count) // As for get_current
+		throw empty_collection_exception();
+	return const_iterator(this, current);
+}
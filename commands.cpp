@@ -0,0 +1,424 @@
+/*
+* commands.cpp
+* Written by : SENG1120 Staff (c1234567)
+* Modified   : 17/10/2026
+*
+* Parsing and execution of browser commands, shared by every way of running the browser.
+*/ 
+
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "commands.h"
+#include "stats.h"
+
+/*
+* Display a the help menu.
+*/
+void show_help(std::ostream& out)
+{
+    out
+    << "============================================[ Commands ]============================================" << std::endl 
+    << "  v [url]" << std::endl 
+    << "      Visit the specified URL." << std::endl 
+    << "  < [steps]" << std::endl 
+    << "      Move backward the specified number of steps." << std::endl 
+    << "  > [steps]" << std::endl 
+    << "      Move forward the specified number of steps." << std::endl 
+    << "  r [url]" << std::endl 
+    << "      Remove all history entries for the given URL." << std::endl 
+    << "  R [url|domain|prefix] [key]..." << std::endl 
+    << "      Remove all history entries that are one of the URLs, are on one of the domains (or a" << std::endl 
+    << "      subdomain), or start with one of the prefixes, printing how many went for each key." << std::endl 
+    << "  a [prefix] [count]" << std::endl 
+    << "      List up to count (default 10) URLs in the history or bookmarks starting with prefix," << std::endl 
+    << "      the most often visited first." << std::endl 
+    << "  t [count]" << std::endl 
+    << "      List the count sites with the most entries in the history." << std::endl 
+    << "  b" << std::endl 
+    << "      Bookmark/unbookmark the current URL. " << std::endl 
+    << "  c" << std::endl 
+    << "      Clear the history, resetting to the homepage." << std::endl 
+    << "  p" << std::endl 
+    << "      Prints the bookmark list." << std::endl 
+    << "  H" << std::endl 
+    << "      Counts the number of elements in the history list." << std::endl 
+    << "  B" << std::endl 
+    << "      Counts the number of elements in the bookmark list." << std::endl 
+    << "  V [index]" << std::endl 
+    << "      Visits the bookmark with specified index, if it exists." << std::endl 
+    << "  n" << std::endl 
+    << "      Open a new tab on the homepage." << std::endl 
+    << "  d" << std::endl 
+    << "      Duplicate the current tab, history and all." << std::endl 
+    << "  x" << std::endl 
+    << "      Close the current tab." << std::endl 
+    << "  w [index]" << std::endl 
+    << "      Switch to the tab with specified index, if it exists." << std::endl 
+    << "  T" << std::endl 
+    << "      Prints the list of tabs." << std::endl 
+    << "  S" << std::endl 
+    << "      Print command timings and list statistics (needs --stats)." << std::endl 
+    << "  q" << std::endl 
+    << "      Quit." << std::endl 
+    << "  ?" << std::endl 
+    << "      Show this help menu." << std::endl 
+    << "=====================================================================================================" << std::endl ;
+}
+
+/*
+* Break a command into tokens (i.e., split by space), without copying. Splitting matches std::getline with a
+* ' ' delimiter: consecutive spaces give empty tokens, and a single trailing space does not start a new token.
+* Up to max_tokens tokens are stored as views into command, and the total number of tokens is returned.
+*/
+std::size_t parse_command(std::string_view command, std::string_view* tokens, std::size_t max_tokens)
+{
+    std::size_t count = 0;
+    std::size_t start = 0;
+
+    while (start < command.size())
+    {
+        std::size_t space = command.find(' ', start);
+        if (space == std::string_view::npos)
+        {
+            space = command.size();
+        }
+        if (count < max_tokens)
+        {
+            tokens[count] = command.substr(start, space - start);
+        }
+        count++;
+        start = space + 1;
+    }
+
+    return count;
+}
+
+/*
+* Return the second token of a command of the form <command> <argument>.
+*/
+std::string_view parse_argument(std::string_view command)
+{
+    std::string_view tokens[2];
+    std::size_t count = parse_command(command, tokens, 2);
+    if (count != 2) 
+    {
+        throw std::invalid_argument("Invalid command. Command must have only 2 tokens, you provided: " + std::to_string(count));
+    }
+
+    //tokens[0] is the command, which we can ignore
+    return tokens[1];
+}
+
+/*
+* Return the integer for a command of the form <command> <integer>.
+* Like std::stoi, leading whitespace and a '+' sign are accepted and anything after the digits is ignored.
+*/
+int parse_int_command(std::string_view command)
+{
+    std::string_view token = parse_argument(command);
+
+    const char* first = token.data();
+    const char* last = first + token.size();
+    while (first != last && std::isspace(static_cast<unsigned char>(*first)))
+    {
+        first++;
+    }
+    if (last - first > 1 && *first == '+' && first[1] != '-')
+    {
+        first++; //from_chars only understands '-'
+    }
+
+    int value;
+    if (std::from_chars(first, last, value).ec != std::errc())
+    {
+        throw std::invalid_argument("Error parsing integer in command.");
+    }
+    return value;
+}
+
+/*
+* Return the string for a command of the form <command> <string>, as a view into command.
+*/
+std::string_view parse_string_command(std::string_view command)
+{
+    return parse_argument(command);
+}
+
+/*
+* Parse a command of the form R <url|domain|prefix> <key> <key>..., returning the keys as views into command.
+*/
+static std::vector<std::string_view> parse_remove_command(std::string_view command, RemoveMatch& match)
+{
+    std::size_t count = parse_command(command, nullptr, 0);
+    if (count < 3)
+    {
+        throw std::invalid_argument("Invalid command. R needs a match kind and at least one key.");
+    }
+    std::vector<std::string_view> tokens(count);
+    parse_command(command, tokens.data(), count);
+
+    if (tokens[1] == "url")
+    {
+        match = REMOVE_URL;
+    }
+    else if (tokens[1] == "domain")
+    {
+        match = REMOVE_DOMAIN;
+    }
+    else if (tokens[1] == "prefix")
+    {
+        match = REMOVE_PREFIX;
+    }
+    else
+    {
+        throw std::invalid_argument("Unknown match kind: " + std::string(tokens[1]) + ". Use url, domain or prefix.");
+    }
+    return std::vector<std::string_view>(tokens.begin() + 2, tokens.end());
+}
+
+/*
+* Number of completions listed by the a command when no count is given.
+*/
+static const int DEFAULT_COMPLETIONS = 10;
+
+/*
+* Parse a command of the form a <prefix> [count], returning the prefix as a view into command.
+*/
+static std::string_view parse_complete_command(std::string_view command, int& count)
+{
+    std::string_view tokens[3];
+    std::size_t token_count = parse_command(command, tokens, 3);
+    if (token_count == 2)
+    {
+        count = DEFAULT_COMPLETIONS;
+    }
+    else if (token_count == 3)
+    {
+        const char* first = tokens[2].data();
+        const char* last = first + tokens[2].size();
+        std::from_chars_result parsed = std::from_chars(first, last, count);
+        if (parsed.ec != std::errc() || parsed.ptr != last || count < 0)
+        {
+            throw std::invalid_argument("Error parsing count in command.");
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid command. Command must have 2 or 3 tokens, you provided: " + std::to_string(token_count));
+    }
+    return tokens[1];
+}
+
+/*
+* Helper method to determine the method to execute based on the command.
+* Output is written to out and error messages to err.
+* The return value determines whether to continue execution.
+*/
+static bool dispatch_command(Browser& browser, std::string_view command, std::ostream& out, std::ostream& err)
+{
+    char cmd = command.empty() ? '\0' : command[0]; //the first character is the command code
+
+    switch (cmd)
+    {
+    case 'v':
+        try
+        {
+            std::string_view url = parse_string_command(command);
+            browser.visit(url);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case '<':
+        try
+        {
+            int steps = parse_int_command(command);
+            browser.back(steps);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case '>':
+        try
+        {
+            int steps = parse_int_command(command);
+            browser.forward(steps);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'r':
+        try
+        {
+            std::string_view url = parse_string_command(command);
+            browser.remove(url);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'R':
+        try
+        {
+            RemoveMatch match;
+            std::vector<std::string_view> keys = parse_remove_command(command, match);
+            std::vector<int> counts = browser.remove_many(keys, match);
+            for (std::size_t i = 0; i < keys.size(); i++)
+            {
+                out << "Removed " << counts[i] << " history entries for " << keys[i] << "." << std::endl;
+            }
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'a':
+        try
+        {
+            int count;
+            std::string_view prefix = parse_complete_command(command, count);
+            std::vector<std::string_view> completions = browser.complete(prefix, count);
+            if (completions.empty())
+            {
+                out << "No completions for " << prefix << "." << std::endl;
+            }
+            for (std::size_t i = 0; i < completions.size(); i++)
+            {
+                out << completions[i] << std::endl;
+            }
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 't':
+        try
+        {
+            int count = parse_int_command(command);
+            std::vector<std::pair<std::string_view, int> > sites = browser.most_visited(count);
+            if (sites.empty())
+            {
+                out << "No sites to list." << std::endl;
+            }
+            for (std::size_t i = 0; i < sites.size(); i++)
+            {
+                out << i + 1 << ". " << sites[i].first << " (" << sites[i].second << (sites[i].second == 1 ? " visit)" : " visits)") << std::endl;
+            }
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'b':
+        browser.bookmark_current();
+        break;
+    case 'c':
+        browser.clear_history();
+        break;
+    case 'p':
+        browser.print_bookmarks();
+        break;
+    case 'H':
+        out << "Number of elements in history: " << browser.count_history() << std::endl;
+        break;
+    case 'B':
+        out << "Number of elements in bookmarks: " << browser.count_bookmarks() << std::endl;
+        break;
+    case 'V':
+        try
+        {
+            int index = parse_int_command(command);
+            browser.visit_bookmark(index);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'n':
+        browser.new_tab();
+        break;
+    case 'd':
+        browser.duplicate_tab();
+        break;
+    case 'x':
+        browser.close_tab();
+        break;
+    case 'w':
+        try
+        {
+            int index = parse_int_command(command);
+            browser.switch_tab(index);
+        }
+        catch(const std::exception& e)
+        {
+            err << e.what() << '\n';
+        }
+        break;
+    case 'T':
+        browser.print_tabs();
+        break;
+    case 'q':
+        return false; //used to flag that we want to exit
+        break;
+    case 'S':
+        BrowserStats::print(out);
+        break;
+    case '?':
+        show_help(out);
+        break;
+    default:
+        out << "Unknown command: " << command << std::endl;
+        break;
+    }
+
+    return true;
+}
+
+/*
+* Execute a command, timing it when statistics are being collected.
+* The return value determines whether to continue execution.
+*/
+bool execute_command(Browser& browser, std::string_view command, std::ostream& out, std::ostream& err)
+{
+#ifdef BROWSER_STATS
+    if (BrowserStats::enabled())
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool do_continue = dispatch_command(browser, command, out, err);
+        std::chrono::nanoseconds taken = std::chrono::steady_clock::now() - start;
+        BrowserStats::record(command.empty() ? '\0' : command[0], static_cast<std::uint64_t>(taken.count()));
+        return do_continue;
+    }
+#endif
+    return dispatch_command(browser, command, out, err);
+}
+
+/*
+* Replay one command from a file the way file mode prints it: the current site, the command, its output and a
+* blank line.
+* The return value determines whether to continue execution.
+*/
+bool replay_command(Browser& browser, std::string_view command, std::ostream& out, std::ostream& err)
+{
+    out << "Current site: " << browser.get_current_site() << std::endl;
+    out << "Executing command: " << command << std::endl;
+    bool do_continue = execute_command(browser, command, out, err);
+    out << std::endl;
+    return do_continue;
+}
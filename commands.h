@@ -0,0 +1,59 @@
+/*
+* commands.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* Parsing and execution of browser commands, shared by the interactive driver, file mode and session replay.
+* Nothing here writes to std::cout or std::cerr directly, so several browsers can run commands at once, each
+* writing to its own streams.
+*/
+
+#ifndef SENG1120_COMMANDS_H
+#define SENG1120_COMMANDS_H
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+#include "browser.h"
+
+/*
+* Display the help menu.
+*/
+void show_help(std::ostream& out);
+
+/*
+* Break a command into tokens (i.e., split by space), without copying.
+* Up to max_tokens tokens are stored as views into command, and the total number of tokens is returned.
+*/
+std::size_t parse_command(std::string_view command, std::string_view* tokens, std::size_t max_tokens);
+
+/*
+* Return the second token of a command of the form <command> <argument>, throwing std::invalid_argument
+* if the command does not have exactly 2 tokens.
+*/
+std::string_view parse_argument(std::string_view command);
+
+/*
+* Return the integer for a command of the form <command> <integer>, throwing std::invalid_argument on error.
+*/
+int parse_int_command(std::string_view command);
+
+/*
+* Return the string for a command of the form <command> <string>, throwing std::invalid_argument on error.
+*/
+std::string_view parse_string_command(std::string_view command);
+
+/*
+* Execute one command on browser, writing its output to out and any error message to err.
+* Return false if the command asks to quit.
+*/
+bool execute_command(Browser& browser, std::string_view command, std::ostream& out, std::ostream& err);
+
+/*
+* Execute one command as file mode does, first writing the current site and the command to out and then
+* a blank line after its output. Return false if the command asks to quit.
+*/
+bool replay_command(Browser& browser, std::string_view command, std::ostream& out, std::ostream& err);
+
+#endif
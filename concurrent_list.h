@@ -0,0 +1,193 @@
+/*
+* concurrent_list.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a templated singly linked list that can be shared between threads. Unlike LinkedList it
+* has no current pointer of its own: readers walk the list through Cursor objects, so any number of threads can
+* read at once without locking and without disturbing each other.
+*
+* Writers are serialised by a mutex. A removed node is unlinked at once but only freed when no cursor could still
+* be on it, which is tracked with epochs: each cursor announces the epoch it started reading in, and a node removed
+* in epoch e is freed once every active cursor announced an epoch after e. A cursor that was already on a removed
+* node can keep reading it and carry on to the nodes after it.
+*/
+
+#ifndef SENG1120_CONCURRENT_LIST_H
+#define SENG1120_CONCURRENT_LIST_H
+
+#include "empty_collection_exception.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class ConcurrentList
+{
+private:
+    struct ListNode
+    {
+        T data;
+        std::atomic<ListNode*> next;
+
+        ListNode(const T& data) : data(data), next(nullptr) {}
+    };
+
+    // One per cursor that has ever existed at the same time; reused once its cursor is destroyed
+    struct ReaderSlot
+    {
+        std::atomic<std::uint64_t> epoch;           // Epoch the cursor is reading in, or 0 when it is not reading
+        std::atomic<bool> in_use;
+        ReaderSlot* next;
+    };
+
+public:
+    /*
+    * Reads the list without locking. A cursor keeps the nodes it can reach from being freed for as long as it
+    * exists, or until begin is called again, so it should not be kept around idle.
+    */
+    class Cursor
+    {
+    public:
+        /*
+        * Precondition:    list outlives the cursor.
+        * Postcondition:   The cursor is on the first element of list, or not on any element if it is empty.
+        */
+        Cursor(const ConcurrentList<T>& list);
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor no longer holds back the freeing of removed nodes.
+        */
+        ~Cursor();
+
+        /*
+        * Start again from the first element, letting go of every node seen so far.
+        *
+        * Precondition:    None
+        * Postcondition:   The cursor is on the first element, or not on any element if the list is empty.
+        */
+        void begin();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor moves to the next element, or off the end if it was on the last one.
+        */
+        void forward();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   true is returned if the cursor is on an element.
+        */
+        bool valid() const;
+
+        /*
+        * Precondition:    The cursor is on an element.
+        * Postcondition:   A reference to the element is returned. It stays valid while the cursor is on it.
+        */
+        const T& get_current() const;
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor is on the first element equal to target and true is returned; otherwise the
+        *                  cursor is not on any element and false is returned.
+        */
+        bool search(const T& target);
+
+    private:
+        Cursor(const Cursor&);                      // Not copyable
+        Cursor& operator=(const Cursor&);
+
+        const ConcurrentList<T>* list;
+        ReaderSlot* slot;
+        ListNode* current;
+    };
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A new, empty list is created.
+    */
+    ConcurrentList();
+
+    /*
+    * Precondition:    No cursor on the list exists and no other thread is using it.
+    * Postcondition:   The list is destroyed and all associated memory is freed.
+    */
+    ~ConcurrentList();
+
+    /*
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated.
+    */
+    void push_front(const T& data);
+
+    /*
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated.
+    */
+    void push_back(const T& data);
+
+    /*
+    * Remove the first data element. An exception is thrown if the list is empty.
+    *
+    * Precondition:    The list is not empty.
+    * Postcondition:   The first data element has been removed and returned.
+    */
+    T pop_front();
+
+    /*
+    * Remove the first element equal to target.
+    *
+    * Precondition:    None
+    * Postcondition:   If an element was equal to target, the first one has been removed and true is returned.
+    */
+    bool remove(const T& target);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The list is empty.
+    */
+    void clear();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   true is returned if an element is equal to target. The list is not locked.
+    */
+    bool contains(const T& target) const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The number of elements is returned.
+    */
+    int size() const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    bool empty() const;
+
+private:
+    ConcurrentList(const ConcurrentList<T>&);                  // Not copyable
+    ConcurrentList<T>& operator=(const ConcurrentList<T>&);
+
+    ReaderSlot* acquire_slot() const;               // Find a free reader slot, or add one
+    void retire(ListNode* node);                    // Free node once no cursor can be on it; writers only
+    void reclaim();                                 // Free every retired node no cursor can be on; writers only
+
+    std::atomic<ListNode*> head;                    // First node, or null
+    ListNode* tail;                                 // Last node, or null; writers only
+    std::atomic<int> count;                         // Number of elements
+    std::mutex writer;                              // Held by every operation that changes the list
+
+    std::atomic<std::uint64_t> epoch;               // Current epoch, advanced whenever a node is removed
+    mutable std::atomic<ReaderSlot*> readers;       // Every reader slot, newest first
+    std::vector<std::pair<ListNode*, std::uint64_t> > retired;  // Removed nodes and the epoch they were removed in
+    std::size_t reclaim_at;                         // Size of retired at which to try freeing them again
+};
+
+#include "concurrent_list.hpp"
+
+#endif
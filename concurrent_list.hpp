@@ -0,0 +1,301 @@
+/*
+ * concurrent_list.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+// Number of removed nodes to collect before first trying to free them, so the reader slots are not scanned on every removal
+const std::size_t CONCURRENT_LIST_RECLAIM_BATCH = 64;
+
+// ---- Cursor --------
+
+// Constructor for Cursor
+// Precondition:   list outlives the cursor.
+// Postcondition:  The cursor is on the first element of list, or not on any element if it is empty.
+template <typename T>
+ConcurrentList<T>::Cursor::Cursor(const ConcurrentList<T> &list)
+		: list(&list), slot(list.acquire_slot()), current(nullptr)
+{
+	begin();
+}
+
+// Destructor for Cursor
+// Precondition:   None
+// Postcondition:  The cursor no longer holds back the freeing of removed nodes.
+template <typename T>
+ConcurrentList<T>::Cursor::~Cursor()
+{
+	slot->epoch.store(0);			// No longer reading
+	slot->in_use.store(false); // Let another cursor have the slot
+}
+
+// Start again from the first element, announcing the current epoch
+// Precondition:   None
+// Postcondition:  The cursor is on the first element, or not on any element if the list is empty.
+template <typename T>
+void ConcurrentList<T>::Cursor::begin()
+{
+	slot->epoch.store(list->epoch.load());
+	std::atomic_thread_fence(std::memory_order_seq_cst); // Announce before reading, so a writer either sees us or we miss its removals
+	current = list->head.load(std::memory_order_acquire);
+}
+
+// Move to the next element
+// Precondition:   None
+// Postcondition:  The cursor moves to the next element, or off the end if it was on the last one.
+template <typename T>
+void ConcurrentList<T>::Cursor::forward()
+{
+	if (current != nullptr)
+		current = current->next.load(std::memory_order_acquire);
+}
+
+// Return true if the cursor is on an element
+// Precondition:   None
+// Postcondition:  true is returned if the cursor is on an element.
+template <typename T>
+bool ConcurrentList<T>::Cursor::valid() const
+{
+	return current != nullptr;
+}
+
+// Return a reference to the element the cursor is on
+// Precondition:   The cursor is on an element.
+// Postcondition:  A reference to the element is returned.
+template <typename T>
+const T &ConcurrentList<T>::Cursor::get_current() const
+{
+	if (current == nullptr) // If the cursor is not on an element, throw exception
+		throw empty_collection_exception();
+	return current->data;
+}
+
+// Move to the first element equal to target
+// Precondition:   None
+// Postcondition:  The cursor is on the first element equal to target and true is returned; otherwise it is off the end.
+template <typename T>
+bool ConcurrentList<T>::Cursor::search(const T &target)
+{
+	for (begin(); current != nullptr; forward())
+	{
+		if (current->data == target)
+			return true;
+	}
+	return false;
+}
+
+// ---- ConcurrentList --------
+
+// Constructor for ConcurrentList
+// Precondition:   None
+// Postcondition:  A new, empty list is created.
+template <typename T>
+ConcurrentList<T>::ConcurrentList()
+		: head(nullptr), tail(nullptr), count(0), epoch(1), readers(nullptr), reclaim_at(CONCURRENT_LIST_RECLAIM_BATCH)
+{
+}
+
+// Destructor for ConcurrentList
+// Precondition:   No cursor on the list exists and no other thread is using it.
+// Postcondition:  The list is destroyed and all associated memory is freed.
+template <typename T>
+ConcurrentList<T>::~ConcurrentList()
+{
+	ListNode *node = head.load();
+	while (node != nullptr) // Delete the nodes still in the list
+	{
+		ListNode *next = node->next.load();
+		delete node;
+		node = next;
+	}
+	for (std::size_t i = 0; i < retired.size(); i++) // And the removed ones not freed yet
+		delete retired[i].first;
+	ReaderSlot *slot = readers.load();
+	while (slot != nullptr)
+	{
+		ReaderSlot *next = slot->next;
+		delete slot;
+		slot = next;
+	}
+}
+
+// Find a reader slot that no cursor is using, or add a new one
+template <typename T>
+typename ConcurrentList<T>::ReaderSlot *ConcurrentList<T>::acquire_slot() const
+{
+	for (ReaderSlot *slot = readers.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+	{
+		bool free = false;
+		if (!slot->in_use.load(std::memory_order_relaxed) && slot->in_use.compare_exchange_strong(free, true))
+			return slot;
+	}
+	ReaderSlot *slot = new ReaderSlot;
+	slot->epoch.store(0);
+	slot->in_use.store(true);
+	slot->next = readers.load(std::memory_order_relaxed);
+	while (!readers.compare_exchange_weak(slot->next, slot)) // Push onto the front; slots are never removed
+	{
+	}
+	return slot;
+}
+
+// Hold on to a node that has just been unlinked until no cursor can be on it
+template <typename T>
+void ConcurrentList<T>::retire(ListNode *node)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst); // The unlink is visible before the epoch is read
+	retired.push_back(std::make_pair(node, epoch.fetch_add(1)));
+	if (retired.size() >= reclaim_at)
+		reclaim();
+}
+
+// Free every retired node removed before the oldest epoch any cursor is reading in
+template <typename T>
+void ConcurrentList<T>::reclaim()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	std::uint64_t oldest = epoch.load();
+	for (ReaderSlot *slot = readers.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+	{
+		std::uint64_t reading = slot->epoch.load();
+		if (reading != 0 && reading < oldest)
+			oldest = reading;
+	}
+
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < retired.size(); i++)
+	{
+		if (retired[i].second < oldest) // Removed before every active cursor started reading
+			delete retired[i].first;
+		else
+			retired[kept++] = retired[i];
+	}
+	retired.resize(kept);
+	reclaim_at = (kept < CONCURRENT_LIST_RECLAIM_BATCH ? CONCURRENT_LIST_RECLAIM_BATCH : 2 * kept); // Do not rescan nodes a slow cursor still holds on every removal
+}
+
+// Insert data at the front of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated.
+template <typename T>
+void ConcurrentList<T>::push_front(const T &data)
+{
+	std::lock_guard<std::mutex> guard(writer);
+	ListNode *node = new ListNode(data);
+	node->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	head.store(node, std::memory_order_release); // Publish the fully built node
+	if (tail == nullptr)
+		tail = node;
+	count.fetch_add(1);
+}
+
+// Insert data at the end of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated.
+template <typename T>
+void ConcurrentList<T>::push_back(const T &data)
+{
+	std::lock_guard<std::mutex> guard(writer);
+	ListNode *node = new ListNode(data);
+	if (tail == nullptr)
+		head.store(node, std::memory_order_release);
+	else
+		tail->next.store(node, std::memory_order_release);
+	tail = node;
+	count.fetch_add(1);
+}
+
+// Remove the first data element
+// Precondition:   The list is not empty.
+// Postcondition:  The first data element has been removed and returned.
+template <typename T>
+T ConcurrentList<T>::pop_front()
+{
+	std::lock_guard<std::mutex> guard(writer);
+	ListNode *node = head.load(std::memory_order_relaxed);
+	if (node == nullptr) // If list is empty, throw exception
+		throw empty_collection_exception();
+	T data = node->data; // Copied, as readers may still be looking at it
+	head.store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+	if (tail == node)
+		tail = nullptr;
+	count.fetch_sub(1);
+	retire(node);
+	return data;
+}
+
+// Remove the first element equal to target
+// Precondition:   None
+// Postcondition:  If an element was equal to target, the first one has been removed and true is returned.
+template <typename T>
+bool ConcurrentList<T>::remove(const T &target)
+{
+	std::lock_guard<std::mutex> guard(writer);
+	ListNode *previous = nullptr;
+	ListNode *node = head.load(std::memory_order_relaxed);
+	while (node != nullptr && !(node->data == target))
+	{
+		previous = node;
+		node = node->next.load(std::memory_order_relaxed);
+	}
+	if (node == nullptr)
+		return false;
+
+	ListNode *next = node->next.load(std::memory_order_relaxed); // Left in place, so a cursor on node can carry on
+	if (previous == nullptr)
+		head.store(next, std::memory_order_release);
+	else
+		previous->next.store(next, std::memory_order_release);
+	if (tail == node)
+		tail = previous;
+	count.fetch_sub(1);
+	retire(node);
+	return true;
+}
+
+// Remove every element
+// Precondition:   None
+// Postcondition:  The list is empty.
+template <typename T>
+void ConcurrentList<T>::clear()
+{
+	std::lock_guard<std::mutex> guard(writer);
+	ListNode *node = head.load(std::memory_order_relaxed);
+	head.store(nullptr, std::memory_order_release);
+	tail = nullptr;
+	count.store(0);
+	while (node != nullptr) // The chain stays intact for any cursor still on it
+	{
+		ListNode *next = node->next.load(std::memory_order_relaxed);
+		retire(node);
+		node = next;
+	}
+}
+
+// Return true if an element is equal to target
+// Precondition:   None
+// Postcondition:  true is returned if an element is equal to target. The list is not locked.
+template <typename T>
+bool ConcurrentList<T>::contains(const T &target) const
+{
+	Cursor cursor(*this);
+	return cursor.search(target);
+}
+
+// Return the number of elements
+// Precondition:   None
+// Postcondition:  The number of elements is returned.
+template <typename T>
+int ConcurrentList<T>::size() const
+{
+	return count.load();
+}
+
+// Return true if the list is empty, false otherwise
+// Precondition:   None
+// Postcondition:  None
+template <typename T>
+bool ConcurrentList<T>::empty() const
+{
+	return count.load() == 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * copy_check.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ *
+ * Checks that the lists copy and move their elements only as often as they must, using Counted, an element that
+ * counts how it is constructed and assigned. For LinkedList, with pooled and with heap nodes, and for
+ * CircularBuffer:
+ *
+ *   push_back/push_front(const T&)  exactly 1 copy
+ *   push_back/push_front(T&&)       exactly 1 move
+ *   emplace_back/emplace_front      1 construction in place on LinkedList; CircularBuffer builds the element
+ *                                   and moves it once into a slot that already exists
+ *   pop_front, pop_back, remove     exactly 1 move
+ *
+ * Run by make check. Nothing is printed if every count is right; otherwise the first wrong one is printed and the
+ * program exits with status 1.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#include "circular_buffer.h"
+#include "linked_list.h"
+
+// Constructions and assignments of Counted so far
+struct CopyCounts
+{
+	long defaults;                  // Default constructions
+	long built;                     // Constructions from a value, as emplace does
+	long copies;                    // Copy constructions and copy assignments
+	long moves;                     // Move constructions and move assignments
+};
+
+static CopyCounts copy_counts;
+
+// Keeps popped values alive so the compiler cannot drop the pops
+static volatile int sink;
+
+// An element that counts how it is constructed and assigned
+struct Counted
+{
+	int value;
+
+	Counted() : value(0) { copy_counts.defaults++; }
+	Counted(int value) : value(value) { copy_counts.built++; }
+	Counted(int high, int low) : value(high * 100 + low) { copy_counts.built++; }
+	Counted(const Counted &other) : value(other.value) { copy_counts.copies++; }
+	Counted(Counted &&other) noexcept : value(other.value) { copy_counts.moves++; }
+	Counted &operator=(const Counted &other) { value = other.value; copy_counts.copies++; return *this; }
+	Counted &operator=(Counted &&other) noexcept { value = other.value; copy_counts.moves++; return *this; }
+	bool operator==(const Counted &other) const { return value == other.value; }
+};
+
+// Run operation and exit with an error unless it did exactly the expected copies, moves and constructions from a
+// value, and no default constructions
+template <typename Operation>
+static void expect_copies(const char *subject, const char *operation, long copies, long moves, long built, Operation run)
+{
+	CopyCounts before = copy_counts;
+	run();
+	long did_defaults = copy_counts.defaults - before.defaults;
+	long did_built = copy_counts.built - before.built;
+	long did_copies = copy_counts.copies - before.copies;
+	long did_moves = copy_counts.moves - before.moves;
+	if (did_defaults != 0 || did_built != built || did_copies != copies || did_moves != moves)
+	{
+		std::fprintf(stderr, "copy_check: %s %s did %ld copies, %ld moves, %ld constructions from a value and %ld "
+					 "default constructions, where %ld, %ld, %ld and 0 were expected\n", subject, operation, did_copies,
+					 did_moves, did_built, did_defaults, copies, moves, built);
+		std::exit(1);
+	}
+}
+
+// Check the copies made by each push, emplace and pop of List. emplaced_moves is 0 for a list that builds the
+// element in place, and 1 for one that builds it and moves it into a slot that already exists.
+template <typename List>
+static void check_copies(const char *subject, long emplaced_moves)
+{
+	List list;
+	Counted value(7);
+	list.push_back(Counted(1)); // Warm the list up, so no operation below has storage to construct
+	list.pop_back();
+
+	expect_copies(subject, "push_back(const T&)", 1, 0, 0, [&]() { list.push_back(value); });
+	expect_copies(subject, "push_front(const T&)", 1, 0, 0, [&]() { list.push_front(value); });
+	expect_copies(subject, "push_back(T&&)", 0, 1, 0, [&]() { list.push_back(std::move(value)); });
+	expect_copies(subject, "push_front(T&&)", 0, 1, 0, [&]() { list.push_front(std::move(value)); });
+	expect_copies(subject, "emplace_back", 0, emplaced_moves, 1, [&]() { list.emplace_back(4, 2); });
+	expect_copies(subject, "emplace_front", 0, emplaced_moves, 1, [&]() { list.emplace_front(4, 2); });
+	expect_copies(subject, "pop_front", 0, 1, 0, [&]() { sink = list.pop_front().value; });
+	expect_copies(subject, "pop_back", 0, 1, 0, [&]() { sink = list.pop_back().value; });
+
+	list.clear();
+	list.push_back(Counted(3)); // Alone, so removing it shifts nothing along in a CircularBuffer
+	list.begin();
+	expect_copies(subject, "remove", 0, 1, 0, [&]() { sink = list.remove().value; });
+}
+
+int main()
+{
+	check_copies<LinkedList<Counted> >("LinkedList-pool", 0);
+	check_copies<LinkedList<Counted, HeapAllocator<Counted> > >("LinkedList-heap", 0);
+	check_copies<CircularBuffer<Counted> >("CircularBuffer", 1);
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+* hash_index.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This file contains the index policies that a LinkedList uses to locate Nodes by value.
+* NoIndex keeps nothing, so search scans the list. HashIndex maps every value to the Nodes that store it,
+* in list order, so that search finds the first match in constant time.
+*
+* While a list is indexed, its data must not be modified in place (for example through get_current),
+* as the index would no longer match the Nodes it refers to.
+*/
+
+#ifndef SENG1120_HASH_INDEX_H
+#define SENG1120_HASH_INDEX_H
+
+#include "node.h"
+#include <unordered_map>
+#include <vector>
+#include <cstddef>
+
+template <typename T>
+class NoIndex
+{
+public:
+    static const bool enabled = false;   // search falls back to a linear scan
+
+    void linked_front(Node<T>*) {}
+    void linked_back(Node<T>*) {}
+    void linked_after(Node<T>*) {}
+    void unlinked(Node<T>*) {}
+    void cleared() {}
+    void reserve(std::size_t) {}
+    Node<T>* find(const T&) const { return nullptr; }
+};
+
+template <typename T, typename Hash = std::hash<T> >
+class HashIndex
+{
+public:
+    static const bool enabled = true;    // search is answered by find
+
+    /*
+    * Precondition:    node has just been linked in as the first data node of the list.
+    * Postcondition:   node is recorded as the first Node storing its value.
+    */
+    void linked_front(Node<T>* node);
+
+    /*
+    * Precondition:    node has just been linked in as the last data node of the list.
+    * Postcondition:   node is recorded as the last Node storing its value.
+    */
+    void linked_back(Node<T>* node);
+
+    /*
+    * Record a node linked into the middle of the list. This walks forward to the next Node storing the
+    * same value, so it costs O(distance) rather than O(1).
+    *
+    * Precondition:    node has just been linked in between two other nodes of the list.
+    * Postcondition:   node is recorded in list order among the Nodes storing its value.
+    */
+    void linked_after(Node<T>* node);
+
+    /*
+    * Precondition:    node is recorded in the index and is about to be destroyed.
+    * Postcondition:   node is no longer recorded in the index.
+    */
+    void unlinked(Node<T>* node);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The index is empty.
+    */
+    void cleared();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Up to n distinct values can be recorded without the index rehashing.
+    */
+    void reserve(std::size_t n);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The first Node (in list order) storing target is returned, or nullptr if there is none.
+    */
+    Node<T>* find(const T& target) const;
+
+private:
+    // The Nodes storing one value, in list order. Entries before first have been removed from the front
+    // and are compacted away lazily, so evicting the oldest entry does not shift the whole bucket.
+    struct Bucket
+    {
+        Bucket() : first(0) {}
+
+        std::vector<Node<T>*> nodes;
+        std::size_t first;
+    };
+
+    void compact(Bucket& bucket);       // Drop the dead prefix once it outweighs the live entries
+
+    std::unordered_map<T, Bucket, Hash> buckets;
+};
+
+#include "hash_index.hpp"
+
+#endif
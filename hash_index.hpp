@@ -0,0 +1,122 @@
+/*
+ * hash_index.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include <algorithm>
+
+// Record a node linked in as the first data node of the list
+// Precondition:   node has just been linked in as the first data node of the list.
+// Postcondition:  node is recorded as the first Node storing its value.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::linked_front(Node<T> *node)
+{
+	Bucket &bucket = buckets[node->get_data()];
+	if (bucket.first > 0)
+		bucket.nodes[--bucket.first] = node; // Reuse a dead slot at the front
+	else
+		bucket.nodes.insert(bucket.nodes.begin(), node);
+}
+
+// Record a node linked in as the last data node of the list
+// Precondition:   node has just been linked in as the last data node of the list.
+// Postcondition:  node is recorded as the last Node storing its value.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::linked_back(Node<T> *node)
+{
+	buckets[node->get_data()].nodes.push_back(node);
+}
+
+// Record a node linked into the middle of the list
+// Precondition:   node has just been linked in between two other nodes of the list.
+// Postcondition:  node is recorded in list order among the Nodes storing its value.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::linked_after(Node<T> *node)
+{
+	Bucket &bucket = buckets[node->get_data()];
+	if (bucket.first == bucket.nodes.size()) // The only node with this value, so there is no order to keep
+	{
+		bucket.nodes.push_back(node);
+		return;
+	}
+
+	// Find the next node storing the same value; the tail sentinel is the only node without a next
+	Node<T> *successor = node->get_next();
+	while (successor->get_next() != nullptr && !(successor->get_data() == node->get_data()))
+		successor = successor->get_next();
+
+	if (successor->get_next() == nullptr) // No later match, so node is the last one
+	{
+		bucket.nodes.push_back(node);
+		return;
+	}
+	typename std::vector<Node<T> *>::iterator position =
+			std::find(bucket.nodes.begin() + bucket.first, bucket.nodes.end(), successor);
+	bucket.nodes.insert(position, node); // Insert just before the later match
+}
+
+// Forget a node that is about to be destroyed
+// Precondition:   node is recorded in the index and is about to be destroyed.
+// Postcondition:  node is no longer recorded in the index.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::unlinked(Node<T> *node)
+{
+	typename std::unordered_map<T, Bucket, Hash>::iterator entry = buckets.find(node->get_data());
+	if (entry == buckets.end())
+		return;
+	Bucket &bucket = entry->second;
+
+	if (bucket.nodes[bucket.first] == node) // Oldest match, e.g. pop_front or a remove loop
+		bucket.first++;
+	else if (bucket.nodes.back() == node) // Newest match, e.g. pop_back
+		bucket.nodes.pop_back();
+	else
+		bucket.nodes.erase(std::find(bucket.nodes.begin() + bucket.first, bucket.nodes.end(), node));
+
+	if (bucket.first == bucket.nodes.size())
+		buckets.erase(entry); // No node stores this value any more
+	else
+		compact(bucket);
+}
+
+// Drop the dead prefix of a bucket once it outweighs the live entries
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::compact(Bucket &bucket)
+{
+	if (bucket.first >= 16 && bucket.first * 2 >= bucket.nodes.size())
+	{
+		bucket.nodes.erase(bucket.nodes.begin(), bucket.nodes.begin() + bucket.first);
+		bucket.first = 0;
+	}
+}
+
+// Forget every node
+// Precondition:   None
+// Postcondition:  The index is empty.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::cleared()
+{
+	buckets.clear();
+}
+
+// Set aside room for n distinct values
+// Precondition:   None
+// Postcondition:  Up to n distinct values can be recorded without the index rehashing.
+template <typename T, typename Hash>
+void HashIndex<T, Hash>::reserve(std::size_t n)
+{
+	buckets.reserve(n);
+}
+
+// Return the first node storing target
+// Precondition:   None
+// Postcondition:  The first Node (in list order) storing target is returned, or nullptr if there is none.
+template <typename T, typename Hash>
+Node<T> *HashIndex<T, Hash>::find(const T &target) const
+{
+	typename std::unordered_map<T, Bucket, Hash>::const_iterator entry = buckets.find(target);
+	if (entry == buckets.end())
+		return nullptr;
+	return entry->second.nodes[entry->second.first];
+}
@@ -0,0 +1,162 @@
+/*
+* inline_string.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a string that keeps short text inside the object itself. An InlineString<Size> is Size
+* bytes: text of up to Size - 1 characters is stored in place, with its length in the last byte, and only longer
+* text is copied to the heap. It can be stored in any of the lists as it is, so a LinkedList<InlineUrl> keeps
+* each URL inside its Node, one allocation (none with a NodePool) per element, where a LinkedList<std::string>
+* also allocates the text of every URL longer than the std::string's own small buffer. With the default Size
+* of 48 a Node<InlineUrl> is 64 bytes, so search reads one cache line per element.
+*/
+
+#ifndef SENG1120_INLINE_STRING_H
+#define SENG1120_INLINE_STRING_H
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+template <std::size_t Size = 48>
+class InlineString
+{
+public:
+    static const std::size_t INLINE_CAPACITY = Size - 1;    // Longest text kept in place
+
+    /*
+    * Precondition:    None
+    * Postcondition:   An empty string is created.
+    */
+    InlineString();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A string holding a copy of text is created, on the heap only if it is longer than
+    *                  INLINE_CAPACITY.
+    */
+    InlineString(std::string_view text);
+
+    /*
+    * Precondition:    text is null-terminated.
+    * Postcondition:   As above.
+    */
+    InlineString(const char* text);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   As above.
+    */
+    InlineString(const std::string& text);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A copy of other is created.
+    */
+    InlineString(const InlineString& other);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The text of other is taken over, leaving other empty; nothing is allocated.
+    */
+    InlineString(InlineString&& other) noexcept;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The string is destroyed, freeing its text if it was on the heap.
+    */
+    ~InlineString();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The string holds a copy of the text of other, or takes it over if other is a temporary.
+    */
+    InlineString& operator=(InlineString other) noexcept;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The texts of this string and other are exchanged; nothing is allocated.
+    */
+    void swap(InlineString& other) noexcept;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A view of the text is returned, valid until the string is changed or destroyed.
+    */
+    std::string_view view() const;
+    operator std::string_view() const { return view(); }
+
+    const char* data() const;
+    std::size_t size() const;
+    bool empty() const { return size() == 0; }
+
+    /*
+    * Precondition:    None
+    * Postcondition:   true is returned if the text is stored in place rather than on the heap.
+    */
+    bool is_inline() const;
+
+    /*
+    * Compares the tags first, so strings of different lengths that are both in place are told apart without
+    * reading their text.
+    *
+    * Precondition:    None
+    * Postcondition:   true is returned if a and b hold the same text.
+    */
+    template <std::size_t N>
+    friend bool operator==(const InlineString<N>& a, const InlineString<N>& b);
+
+    friend bool operator!=(const InlineString& a, const InlineString& b) { return !(a == b); }
+    friend bool operator<(const InlineString& a, const InlineString& b) { return a.view() < b.view(); }
+
+private:
+    static const unsigned char ON_HEAP = 0xFF;  // Tag for text stored on the heap
+
+    void assign(const char* text, std::size_t length);  // Fill a string that holds nothing yet
+
+    unsigned char tag() const { return static_cast<unsigned char>(bytes.text[Size - 1]); }
+
+    struct HeapText
+    {
+        char* text;
+        std::size_t length;
+    };
+
+    union Bytes
+    {
+        char text[Size];                // Text in place, with the last byte holding its length or ON_HEAP
+        HeapText heap;                  // Text on the heap, while the last byte is ON_HEAP
+    } bytes;
+
+    static_assert(Size >= sizeof(HeapText) + 1, "InlineString must have room for a heap pointer and its tag");
+    static_assert(Size - 1 < ON_HEAP, "The length of inline text must fit in its tag");
+};
+
+// A URL, stored in place unless it is over 47 characters
+typedef InlineString<48> InlineUrl;
+
+/*
+* Precondition:    None
+* Postcondition:   The text of value has been written to out.
+*/
+template <std::size_t Size>
+std::ostream& operator<<(std::ostream& out, const InlineString<Size>& value);
+
+namespace std
+{
+    // Hashes an InlineString as its text, so it can key an unordered_map or a HashIndex
+    template <std::size_t Size>
+    struct hash<InlineString<Size> >
+    {
+        std::size_t operator()(const InlineString<Size>& value) const
+        {
+            return hash<std::string_view>()(value.view());
+        }
+    };
+}
+
+#include "inline_string.hpp"
+
+#endif
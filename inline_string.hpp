@@ -0,0 +1,151 @@
+/*
+ * inline_string.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include <cstring>
+
+// Constructor for InlineString
+// Precondition:   None
+// Postcondition:  An empty string is created.
+template <std::size_t Size>
+InlineString<Size>::InlineString()
+{
+	bytes.text[Size - 1] = 0; // Inline, with a length of 0
+}
+
+// Constructors for InlineString from text
+// Precondition:   None
+// Postcondition:  A string holding a copy of text is created.
+template <std::size_t Size>
+InlineString<Size>::InlineString(std::string_view text)
+{
+	assign(text.data(), text.size());
+}
+
+template <std::size_t Size>
+InlineString<Size>::InlineString(const char *text)
+{
+	assign(text, std::strlen(text));
+}
+
+template <std::size_t Size>
+InlineString<Size>::InlineString(const std::string &text)
+{
+	assign(text.data(), text.size());
+}
+
+// Copy constructor for InlineString
+// Precondition:   None
+// Postcondition:  A copy of other is created.
+template <std::size_t Size>
+InlineString<Size>::InlineString(const InlineString &other)
+{
+	if (other.is_inline()) // Copy the bytes as they are, tag and all
+		std::memcpy(bytes.text, other.bytes.text, Size);
+	else
+		assign(other.bytes.heap.text, other.bytes.heap.length);
+}
+
+// Move constructor for InlineString
+// Precondition:   None
+// Postcondition:  The text of other is taken over and other is left empty.
+template <std::size_t Size>
+InlineString<Size>::InlineString(InlineString &&other) noexcept
+{
+	std::memcpy(bytes.text, other.bytes.text, Size); // Nothing points into the object, so its bytes can move
+	other.bytes.text[Size - 1] = 0;
+}
+
+// Destructor for InlineString
+// Precondition:   None
+// Postcondition:  Any heap text is freed.
+template <std::size_t Size>
+InlineString<Size>::~InlineString()
+{
+	if (!is_inline())
+		delete[] bytes.heap.text;
+}
+
+// Copy the text into place, or onto the heap if it does not fit
+template <std::size_t Size>
+void InlineString<Size>::assign(const char *text, std::size_t length)
+{
+	if (length <= INLINE_CAPACITY)
+	{
+		std::memcpy(bytes.text, text, length);
+		bytes.text[Size - 1] = static_cast<char>(length);
+	}
+	else
+	{
+		bytes.heap.text = new char[length];
+		std::memcpy(bytes.heap.text, text, length);
+		bytes.heap.length = length;
+		bytes.text[Size - 1] = static_cast<char>(ON_HEAP);
+	}
+}
+
+// Assignment, taking other by value so one version covers both copies and moves
+template <std::size_t Size>
+InlineString<Size> &InlineString<Size>::operator=(InlineString other) noexcept
+{
+	swap(other);
+	return *this;
+}
+
+// Exchange the texts by exchanging the bytes of the two strings
+template <std::size_t Size>
+void InlineString<Size>::swap(InlineString &other) noexcept
+{
+	char held[Size];
+	std::memcpy(held, bytes.text, Size);
+	std::memcpy(bytes.text, other.bytes.text, Size);
+	std::memcpy(other.bytes.text, held, Size);
+}
+
+// Return a view of the text
+template <std::size_t Size>
+std::string_view InlineString<Size>::view() const
+{
+	return std::string_view(data(), size());
+}
+
+// Return the first character of the text
+template <std::size_t Size>
+const char *InlineString<Size>::data() const
+{
+	return is_inline() ? bytes.text : bytes.heap.text;
+}
+
+// Return the length of the text
+template <std::size_t Size>
+std::size_t InlineString<Size>::size() const
+{
+	return is_inline() ? tag() : bytes.heap.length;
+}
+
+// True if the text is stored in place
+template <std::size_t Size>
+bool InlineString<Size>::is_inline() const
+{
+	return tag() != ON_HEAP;
+}
+
+// Compare the tags, which differ for any two lengths in place, before any text
+template <std::size_t Size>
+bool operator==(const InlineString<Size> &a, const InlineString<Size> &b)
+{
+	if (a.tag() != b.tag())
+		return false;
+	if (a.is_inline())
+		return std::memcmp(a.bytes.text, b.bytes.text, a.tag()) == 0;
+	return a.view() == b.view();
+}
+
+// Write the text of value to out
+template <std::size_t Size>
+std::ostream &operator<<(std::ostream &out, const InlineString<Size> &value)
+{
+	return out << value.view();
+}
@@ -0,0 +1,34 @@
+/*
+* item_range.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* A pair of iterators over the elements of a list, returned by items(). The lists already use begin() and end()
+* to move their current pointer, so their iterators are reached through this range instead:
+*
+*     for (const T& value : list.items()) ...
+*     std::count(list.items().begin(), list.items().end(), value)
+*/
+
+#ifndef SENG1120_ITEM_RANGE_H
+#define SENG1120_ITEM_RANGE_H
+
+template <typename Iterator>
+class ItemRange
+{
+public:
+    /*
+    * Precondition:    last is reachable from first.
+    * Postcondition:   A range from first up to, but not including, last is created.
+    */
+    ItemRange(Iterator first, Iterator last) : first(first), last(last) {}
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return last; }
+
+private:
+    Iterator first;
+    Iterator last;
+};
+
+#endif
@@ -0,0 +1,382 @@
+/*
+ * journal.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "journal.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "binary_io.h"
+#include "snapshot.h"
+
+// Version written in every segment header
+static const std::uint32_t JOURNAL_VERSION = 1;
+
+// Magic bytes at the start of every segment
+static const char JOURNAL_MAGIC[4] = {'B', 'R', 'W', 'L'};
+
+// Size of the magic, version and generation
+static const std::size_t SEGMENT_HEADER = 16;
+
+// Size of the length and checksum before each batch
+static const std::size_t BATCH_HEADER = 8;
+
+// Return the name of a segment of the journal at path
+static std::string segment_name(const std::string &path, std::uint64_t generation)
+{
+	return path + ".log." + std::to_string(generation);
+}
+
+// Write all of data to fd, retrying short writes, and return false if it fails
+static bool write_all(int fd, const char *data, std::size_t size)
+{
+	while (size > 0)
+	{
+		ssize_t written = ::write(fd, data, size);
+		if (written < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		data += written;
+		size -= static_cast<std::size_t>(written);
+	}
+	return true;
+}
+
+// Apply the records of one batch to browser
+static void apply(Browser &browser, std::string_view records)
+{
+	ByteReader in(records.data(), records.size(), "Journal batch");
+	while (in.remaining() > 0)
+	{
+		char operation = in.byte();
+		switch (operation)
+		{
+		case 'v':
+			browser.visit(in.string());
+			break;
+		case 'r':
+			browser.remove(in.string());
+			break;
+		case '<':
+			browser.back(static_cast<int>(in.u32()));
+			break;
+		case '>':
+			browser.forward(static_cast<int>(in.u32()));
+			break;
+		case 'V':
+			browser.visit_bookmark(static_cast<int>(in.u32()));
+			break;
+		case 'b':
+			browser.bookmark_current();
+			break;
+		case 'c':
+			browser.clear_history();
+			break;
+		case 'n':
+			browser.new_tab();
+			break;
+		case 'd':
+			browser.duplicate_tab();
+			break;
+		case 'x':
+			browser.close_tab();
+			break;
+		case 'w':
+			browser.switch_tab(static_cast<int>(in.u32()));
+			break;
+		case 'R':
+		{
+			std::uint32_t match = in.u32();
+			if (match > REMOVE_PREFIX)
+				throw std::runtime_error("Journal has an unknown match kind.");
+			std::vector<std::string_view> keys(in.count()); // Every key takes at least 4 bytes
+			for (std::size_t i = 0; i < keys.size(); i++)
+				keys[i] = in.string();
+			browser.remove_many(keys, static_cast<RemoveMatch>(match));
+			break;
+		}
+		default:
+			throw std::runtime_error("Journal has an unknown record.");
+		}
+	}
+}
+
+// Recover a browser from the journal at path and start journaling it
+BrowserJournal::BrowserJournal(Browser &browser, const std::string &path, const JournalOptions &options)
+		: browser(browser), path(path), options(options), homepage(browser.homepage), history_limit(browser.history_limit),
+			fd(-1), current(0), segment_bytes(0), batch(BATCH_HEADER, '\0'), compacting(false)
+{
+	std::uint64_t first = 0;
+	if (file_exists(path))
+		first = BrowserSnapshot::load(browser, path);
+	for (std::uint64_t old = first; old > 0 && file_exists(segment_name(path, old - 1)); old--)
+		std::remove(segment_name(path, old - 1).c_str()); // Folded in by a compaction that stopped before deleting it
+
+	current = first;
+	while (file_exists(segment_name(path, current)))
+	{
+		bool last = !file_exists(segment_name(path, current + 1));
+		std::size_t length = replay(browser, path, current, last);
+		if (last)
+		{
+			if (::truncate(segment_name(path, current).c_str(), static_cast<off_t>(length)) != 0) // Cut off a torn batch
+				throw std::runtime_error("Cannot repair journal " + segment_name(path, current) + ": " + std::strerror(errno));
+			break;
+		}
+		current++;
+	}
+	open_segment(current);
+	browser.journal = this;
+}
+
+// Write what is left, wait for compaction and stop journaling
+BrowserJournal::~BrowserJournal()
+{
+	browser.journal = nullptr;
+	try
+	{
+		append_batch(); // Without starting a compaction on the way out
+	}
+	catch (const std::exception &)
+	{
+		// Nothing can be reported from a destructor; the records are lost as in a crash
+	}
+	if (compactor.joinable())
+		compactor.join();
+	if (fd >= 0)
+		::close(fd);
+}
+
+// Write the batch and start a compaction if the segment is large enough
+void BrowserJournal::commit()
+{
+	write_batch();
+	finish_compaction();
+	if (options.compact_bytes > 0 && segment_bytes >= options.compact_bytes)
+		compact();
+}
+
+// Start folding the closed segments into a new snapshot
+bool BrowserJournal::compact()
+{
+	finish_compaction();
+	if (compacting.load())
+		return false;
+	append_batch();
+
+	std::uint64_t last = current;
+	::close(fd);
+	fd = -1;
+	open_segment(last + 1); // New records go to a fresh segment while the old ones are folded
+
+	compacting.store(true);
+	compactor = std::thread([this, last]()
+	{
+		try
+		{
+			fold(path, homepage, history_limit, last);
+		}
+		catch (...)
+		{
+			compaction_error = std::current_exception();
+		}
+		compacting.store(false);
+	});
+	return true;
+}
+
+// Wait for a compaction to finish
+void BrowserJournal::wait()
+{
+	if (compactor.joinable())
+		compactor.join();
+	if (compaction_error)
+	{
+		std::exception_ptr error = compaction_error;
+		compaction_error = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+// Return the generation of the segment being written
+std::uint64_t BrowserJournal::generation() const
+{
+	return current;
+}
+
+// Record a change with a URL argument
+void BrowserJournal::record(char operation, std::string_view url)
+{
+	batch.push_back(operation);
+	put_string(batch, url);
+	if (batch.size() >= options.batch_bytes)
+		write_batch();
+}
+
+// Record a change with a number argument
+void BrowserJournal::record(char operation, int value)
+{
+	batch.push_back(operation);
+	put_u32(batch, static_cast<std::uint32_t>(value));
+	if (batch.size() >= options.batch_bytes)
+		write_batch();
+}
+
+// Record a change with no argument
+void BrowserJournal::record(char operation)
+{
+	batch.push_back(operation);
+	if (batch.size() >= options.batch_bytes)
+		write_batch();
+}
+
+// Record a change with a number and a list of keys
+void BrowserJournal::record(char operation, int value, const std::vector<std::string_view> &keys)
+{
+	batch.push_back(operation);
+	put_u32(batch, static_cast<std::uint32_t>(value));
+	put_u32(batch, static_cast<std::uint32_t>(keys.size()));
+	for (std::size_t i = 0; i < keys.size(); i++)
+		put_string(batch, keys[i]);
+	if (batch.size() >= options.batch_bytes)
+		write_batch();
+}
+
+// Write the records collected so far as one batch, and start a compaction if the segment is now large enough
+void BrowserJournal::write_batch()
+{
+	append_batch();
+	if (options.compact_bytes > 0 && segment_bytes >= options.compact_bytes)
+		compact(); // Here rather than only in commit, so a driver that commits rarely or never still compacts
+}
+
+// Append the records collected so far to the segment as one batch
+void BrowserJournal::append_batch()
+{
+	if (batch.size() == BATCH_HEADER) // Nothing recorded
+		return;
+	std::string header;
+	put_u32(header, static_cast<std::uint32_t>(batch.size() - BATCH_HEADER));
+	put_u32(header, checksum(std::string_view(batch).substr(BATCH_HEADER)));
+	batch.replace(0, BATCH_HEADER, header);
+
+	if (!write_all(fd, batch.data(), batch.size()) || (options.sync && ::fdatasync(fd) != 0))
+	{
+		int error = errno;
+		batch.resize(BATCH_HEADER);
+		if (::ftruncate(fd, static_cast<off_t>(segment_bytes)) != 0) // Do not leave part of a batch behind
+		{
+			::close(fd); // Later batches would follow the torn one and be lost, so stop writing
+			fd = -1;
+		}
+		throw std::runtime_error("Cannot write journal " + segment_name(path, current) + ": " + std::strerror(error));
+	}
+	segment_bytes += batch.size();
+	batch.resize(BATCH_HEADER);
+}
+
+// Open a segment for appending, writing its header if it is new
+void BrowserJournal::open_segment(std::uint64_t generation)
+{
+	std::string name = segment_name(path, generation);
+	fd = ::open(name.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+	struct stat info;
+	if (fd < 0 || ::fstat(fd, &info) != 0)
+		throw std::runtime_error("Cannot open journal " + name + ": " + std::strerror(errno));
+	current = generation;
+	segment_bytes = static_cast<std::size_t>(info.st_size);
+	if (segment_bytes == 0)
+	{
+		std::string header(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+		put_u32(header, JOURNAL_VERSION);
+		put_u64(header, generation);
+		if (!write_all(fd, header.data(), header.size()) || (options.sync && ::fdatasync(fd) != 0))
+			throw std::runtime_error("Cannot write journal " + name + ": " + std::strerror(errno));
+		segment_bytes = header.size();
+	}
+}
+
+// Join the compaction thread if it has finished
+void BrowserJournal::finish_compaction()
+{
+	if (compactor.joinable() && !compacting.load())
+		compactor.join();
+}
+
+// Replay one segment onto browser, returning the length of its whole batches
+std::size_t BrowserJournal::replay(Browser &browser, const std::string &path, std::uint64_t generation, bool last)
+{
+	std::string name = segment_name(path, generation);
+	MappedFile file(name);
+	if (file.size < SEGMENT_HEADER)
+	{
+		if (last) // Created just before a crash, so nothing was recorded in it
+			return 0;
+		throw std::runtime_error("Journal " + name + " is truncated.");
+	}
+	ByteReader in(file.data, file.size, "Journal");
+	if (in.bytes(sizeof(JOURNAL_MAGIC)) != std::string_view(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) ||
+			in.u32() != JOURNAL_VERSION || in.u64() != generation)
+		throw std::runtime_error("Journal " + name + " has an invalid header.");
+
+	std::ostream *printing = browser.out;
+	std::ostream discard(nullptr); // Writes to a stream with no buffer are dropped
+	browser.out = &discard;
+	std::size_t whole = SEGMENT_HEADER; // Length up to the end of the last whole batch
+	try
+	{
+		while (in.remaining() >= BATCH_HEADER)
+		{
+			std::uint32_t length = in.u32();
+			std::uint32_t sum = in.u32();
+			if (length > in.remaining())
+				break;
+			std::string_view records = in.bytes(length);
+			if (checksum(records) != sum)
+				break;
+			apply(browser, records);
+			whole = file.size - in.remaining();
+		}
+	}
+	catch (...)
+	{
+		browser.out = printing;
+		throw;
+	}
+	browser.out = printing;
+
+	if (whole != file.size && !last)
+		throw std::runtime_error("Journal " + name + " is damaged.");
+	return whole;
+}
+
+// Build a new snapshot from the old one and every segment up to last, then delete those segments
+void BrowserJournal::fold(std::string path, std::string homepage, int history_limit, std::uint64_t last)
+{
+	std::ostream discard(nullptr);
+	Browser scratch(discard, homepage, history_limit);
+	std::uint64_t first = (file_exists(path) ? BrowserSnapshot::load(scratch, path) : 0);
+	if (first > last) // Already folded
+		return;
+	for (std::uint64_t generation = first; generation <= last; generation++)
+	{
+		if (file_exists(segment_name(path, generation)))
+			replay(scratch, path, generation, false);
+	}
+	BrowserSnapshot::save(scratch, path, last + 1);
+	for (std::uint64_t generation = first; generation <= last; generation++)
+		std::remove(segment_name(path, generation).c_str());
+}
@@ -0,0 +1,155 @@
+/*
+* journal.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* An append-only log of the changes made to a Browser, kept next to a snapshot so that the browser survives a
+* crash without its whole state being rewritten after every command.
+*
+* A journal at path keeps the snapshot itself at path (see snapshot.h) and the log in numbered segments
+* path.log.<generation>. Each mutating Browser call (visit, back, forward, remove, remove_many,
+* bookmark_current, clear_history, visit_bookmark, new_tab, duplicate_tab, close_tab and switch_tab) appends
+* a record with the same letter and arguments as the command that asks for it. Records are collected in memory
+* and written in batches (group commit): when a batch reaches batch_bytes, and whenever commit is called. A crash
+* loses at most the records of the batch not yet written.
+* Each segment starts with "BRWL", a u32 version and its u64 generation, and each batch is written as a u32
+* length, a u32 checksum of the records and the records, so a batch torn by a crash is detected and dropped.
+*
+* Compaction folds the log into a fresh snapshot without stopping the browser. It starts once a batch takes the
+* current segment past compact_bytes, whether the batch was full or committed: the current segment is closed
+* and a new one started, and a background thread loads the snapshot into a scratch Browser, replays the closed
+* segments onto it, saves it with the next generation and deletes those segments. A crash during compaction
+* leaves either the old snapshot and all its segments, or the new snapshot and segments it says to ignore.
+*/
+
+#ifndef SENG1120_JOURNAL_H
+#define SENG1120_JOURNAL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "browser.h"
+
+// Batch size at which records are written without waiting for commit
+const std::size_t JOURNAL_BATCH_BYTES = 64 * 1024;
+
+// Segment size at which a compaction is started
+const std::size_t JOURNAL_COMPACT_BYTES = 64 * 1024 * 1024;
+
+// Options for a journal
+struct JournalOptions
+{
+    bool sync;                          // fdatasync the segment after every batch, so a batch survives power loss
+    std::size_t batch_bytes;            // Write the batch once it reaches this size
+    std::size_t compact_bytes;          // Compact once a batch takes the current segment to this size; 0 never does
+};
+
+class BrowserJournal
+{
+public:
+    /**
+     * Recover browser from the journal at path and start journaling its changes. The snapshot is loaded if
+     * there is one, every segment from its generation on is replayed in order, and a batch torn by a crash at
+     * the end of the last segment is cut off. With no snapshot and no segments browser is left as it is,
+     * and its homepage and history limit are the starting point that compaction replays onto. Anything
+     * browser prints while being recovered is discarded. Throws std::runtime_error if the journal is damaged
+     * other than at its end, or cannot be read or written.
+     *
+     * Precondition:  browser has just been constructed, and outlives the journal.
+     * Postcondition: browser is in the state the journal recorded, and its changes are journaled.
+     */
+    BrowserJournal(Browser& browser, const std::string& path, const JournalOptions& options);
+
+    /**
+     * Write any records not yet written, wait for a compaction in progress and stop journaling.
+     *
+     * Precondition:  None
+     * Postcondition: Every record has been written and browser is no longer journaled.
+     */
+    ~BrowserJournal();
+
+    /**
+     * Write the records collected so far as one batch, syncing it if the options ask for that, and start a
+     * compaction if the segment has grown past compact_bytes, as every batch does. Throws std::runtime_error
+     * if writing fails.
+     *
+     * Precondition:  None
+     * Postcondition: Every record so far is in the segment.
+     */
+    void commit();
+
+    /**
+     * Commit, then fold every closed segment into a new snapshot on a background thread. Does nothing and
+     * returns false if a compaction is already running.
+     *
+     * Precondition:  None
+     * Postcondition: A compaction has started and true is returned, or one was already running.
+     */
+    bool compact();
+
+    /**
+     * Wait for a compaction in progress, rethrowing anything it threw.
+     *
+     * Precondition:  None
+     * Postcondition: No compaction is running.
+     */
+    void wait();
+
+    /**
+     * Precondition:  None
+     * Postcondition: The generation of the segment being written is returned.
+     */
+    std::uint64_t generation() const;
+
+    /**
+     * Record a change with a URL argument (v or r), a number argument (<, >, V or w), no argument (b, c, n, d
+     * or x), or a number and a list of keys (R). Called by Browser after the change has been made.
+     *
+     * Precondition:  operation is a letter listed above for the kind of argument.
+     * Postcondition: The record has been added to the batch, which is written if it is now full, starting a
+     *                compaction if that takes the segment past compact_bytes.
+     */
+    void record(char operation, std::string_view url);
+    void record(char operation, int value);
+    void record(char operation);
+    void record(char operation, int value, const std::vector<std::string_view>& keys);
+
+private:
+    BrowserJournal(const BrowserJournal&);      // Not copyable
+    BrowserJournal& operator=(const BrowserJournal&);
+
+    void write_batch();                         // Append the batch and compact if the segment is now large enough
+    void append_batch();                        // Write the records collected so far, if there are any
+    void open_segment(std::uint64_t generation); // Open a segment for appending, writing its header if new
+    void finish_compaction();                   // Join a finished compaction thread, keeping its error
+
+    // Replay segment generation onto browser, returning its length up to the last whole batch; a torn
+    // batch is only allowed if last is set
+    static std::size_t replay(Browser& browser, const std::string& path, std::uint64_t generation, bool last);
+
+    // Build a new snapshot from the old one and segments up to and including last
+    static void fold(std::string path, std::string homepage, int history_limit, std::uint64_t last);
+
+    Browser& browser;
+    std::string path;
+    JournalOptions options;
+    std::string homepage;                       // Starting point for compaction when there is no snapshot
+    int history_limit;
+
+    int fd;                                     // Current segment, open for appending
+    std::uint64_t current;                      // Generation of the current segment
+    std::size_t segment_bytes;                  // Length of the current segment
+    std::string batch;                          // Records not yet written, after room for the batch header
+
+    std::thread compactor;
+    std::atomic<bool> compacting;               // Set while the compaction thread runs
+    std::exception_ptr compaction_error;        // Thrown by the last compaction, until wait rethrows it
+};
+
+#endif
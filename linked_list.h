@@ -11,19 +11,135 @@
 #define SENG1120_LINKEDLIST_H 
 
 #include "node.h"
+#include "node_pool.h"
+#include "hash_index.h"
+#include "access_check.h"
 #include "empty_collection_exception.h"
+#include "item_range.h"
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
 
-template <typename T>
+/*
+* Alloc is the policy used to create and destroy Nodes (see node_pool.h). The default NodePool recycles
+* Node storage, so a list that repeatedly pushes and pops does not call new or delete once it has warmed up.
+*
+* Index is the policy used by search (see hash_index.h). The default NoIndex scans the list; HashIndex finds
+* the first match in constant time, at the cost of updating a hash table on every insertion and removal.
+*
+* Checks is the policy for the functions that throw an empty_collection_exception (see access_check.h). The
+* default CheckedAccess throws; UncheckedAccess drops the tests for a list whose owner already guards its calls.
+*/
+template <typename T, typename Alloc = NodePool<T>, typename Index = NoIndex<T>, typename Checks = CheckedAccess>
 class LinkedList 
 {
 public:
 
+    /*
+    * A bidirectional iterator over the data of the list, from the first node up to tail, for range-for loops and
+    * std:: algorithms. Const selects whether the data can be changed through it. An iterator stays valid until its
+    * node is removed; moving it never throws and never touches the current pointer. As for std::list, moving it
+    * past either end is undefined.
+    */
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const T*, T*>::type pointer;
+        typedef typename std::conditional<Const, const T&, T&>::type reference;
+
+        Iterator() : node(nullptr) {}
+        Iterator(const Iterator<false>& other) : node(other.node) {}   // So an iterator converts to a const_iterator
+
+        reference operator*() const { return node->get_data(); }
+        pointer operator->() const { return &node->get_data(); }
+        Iterator& operator++() { node = node->get_next(); return *this; }
+        Iterator operator++(int) { Iterator was = *this; node = node->get_next(); return was; }
+        Iterator& operator--() { node = node->get_prev(); return *this; }
+        Iterator operator--(int) { Iterator was = *this; node = node->get_prev(); return was; }
+        bool operator==(const Iterator& other) const { return node == other.node; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+
+    private:
+        friend class LinkedList;
+        template <bool> friend class Iterator;
+
+        explicit Iterator(Node<T>* node) : node(node) {}
+
+        Node<T>* node;
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    /*
+    * A read-only position in the list with the same vocabulary as the current pointer, but independent of it.
+    * Unlike current it steps off either end, after which valid returns false, so a loop needs no exceptions and
+    * no comparison of data. A cursor changes nothing in the list, so any number of them, on any number of
+    * threads, can traverse one list at once as long as nothing modifies it.
+    */
+    class Cursor
+    {
+    public:
+        /*
+        * Precondition:    list outlives the cursor.
+        * Postcondition:   The cursor is on the first element of list, or not on any element if it is empty.
+        */
+        Cursor(const LinkedList& list);
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor is on the first element, or not on any element if the list is empty.
+        */
+        void begin();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor is on the last element, or not on any element if the list is empty.
+        */
+        void end();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor moves to the next element, or off the end if it was on the last one.
+        */
+        void forward();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   The cursor moves to the previous element, or off the front if it was on the first one.
+        */
+        void backward();
+
+        /*
+        * Precondition:    None
+        * Postcondition:   true is returned if the cursor is on an element.
+        */
+        bool valid() const;
+
+        /*
+        * Precondition:    The cursor is on an element.
+        * Postcondition:   A reference to the element is returned.
+        */
+        const T& get_current() const;
+
+    private:
+        friend class LinkedList;
+
+        const LinkedList* list;
+        const Node<T>* node;        // Node the cursor is on, or a sentinel once it has stepped off an end
+        int index;                  // Position of node, with head at -1 and tail at size()
+    };
+
     /*
     * Precondition:    None
-    * Postcondition:   A new LinkedList is created, with all variables initialised.
+    * Postcondition:   A new LinkedList is created, with all variables initialised. Nodes are obtained from alloc.
     */
-    LinkedList();
+    LinkedList(const Alloc& alloc = Alloc());
 
     /*
     * Precondition:    None
@@ -40,6 +156,23 @@ public:
     */
     void push_front(const T& data);
 
+    /*
+    * The supplied data is moved into a new node at the front of the list.
+    * 
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_front(T&& data);
+
+    /*
+    * A data item is constructed from args directly inside a new node at the front of the list.
+    * 
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The first data item is updated.
+    */
+    template <typename... Args>
+    void emplace_front(Args&&... args);
+
     /*
     * The supplied data is inserted at the end of the list.
     * 
@@ -47,6 +180,23 @@ public:
     * Postcondition:   The last data item is updated and current points to the new node.
     */
     void push_back(const T& data);
+
+    /*
+    * The supplied data is moved into a new node at the end of the list.
+    * 
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_back(T&& data);
+
+    /*
+    * A data item is constructed from args directly inside a new node at the end of the list.
+    * 
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The last data item is updated.
+    */
+    template <typename... Args>
+    void emplace_back(Args&&... args);
 	
     /*
     * The supplied data is inserted before the current node.
@@ -80,6 +230,17 @@ public:
     * Postcondition:   The data element pointed to by current has been removed, reducing the count of Nodes by 1. Current points to head.
     */
     T remove(); 
+
+    /*
+    * Remove every data element for which pred returns true, in a single pass from front to back. pred is called
+    * exactly once for each element, in list order, so it may keep count of what it matches.
+    * 
+    * Precondition:    pred can be called with a const T& and returns a value convertible to bool.
+    * Postcondition:   The matching elements have been removed and their number is returned. Current stays on its
+    *                  node if that was kept, and otherwise points to head.
+    */
+    template <typename Predicate>
+    int remove_if(Predicate pred);
     
     /*
     * Clears all data elements from the list, leaving the sentinel nodes intact.
@@ -89,6 +250,49 @@ public:
     */
     void clear();
 
+    /*
+    * Move every node of other onto the end of this list by relinking the two chains, without copying or
+    * allocating. This costs O(1), plus one index update per node moved if the list is indexed. If the allocators
+    * are not equal (see node_pool.h), each element is moved into a node from this list's allocator instead.
+    * 
+    * Precondition:    other is not this list.
+    * Postcondition:   The elements of other follow those of this list, and other is empty with current on head.
+    *                  Current stays on its node.
+    */
+    void append(LinkedList&& other);
+
+    /*
+    * Move every node of other into this list before the node position is on: before the first node if position
+    * has stepped off the front, or at the end if it has stepped off the end. Costs as for append.
+    * 
+    * Precondition:    other is not this list, and position is a cursor on this list made or moved since the list
+    *                  last changed.
+    * Postcondition:   The elements of other are in this list before position, and other is empty with current on
+    *                  head. Current stays on its node.
+    */
+    void splice(const Cursor& position, LinkedList& other);
+
+    /*
+    * Move the node position is on and every node after it onto the end of rest, so this list keeps the nodes
+    * before position. Nothing moves if position has stepped off the end, and everything does if it has stepped
+    * off the front. Costs as for append.
+    * 
+    * Precondition:    rest is not this list, and position is a cursor on this list made or moved since the list
+    *                  last changed.
+    * Postcondition:   This list ends before position and rest ends with the nodes that followed. Current stays on
+    *                  its node if that was kept, and otherwise points to head; current of rest stays on its node.
+    */
+    void split_at(const Cursor& position, LinkedList& rest);
+
+    /*
+    * Ask the allocator to set aside storage for n more nodes, so that they can be added without allocating,
+    * and the index to make room for as many values.
+    * 
+    * Precondition:    None
+    * Postcondition:   Up to n nodes can be added without the allocator requesting more memory, if it supports this.
+    */
+    void reserve(int n);
+
     /*
     * Return a reference to the first data element in the list - not the sentinel. An exception should be thrown if the list is empty.
     * 
@@ -145,6 +349,34 @@ public:
     * Postcondition:   The current pointer is set to the previous node, if applicable.
     */    
     void backward();      
+
+    /*
+    * Move the current pointer by the given number of nodes: forward if steps is positive, backward if it is negative.
+    * Movement stops at the first or last node, exactly as repeated calls to forward or backward would.
+    * This walks one node per step, so it costs O(min(|steps|, distance to the end)) with no data comparisons.
+    * 
+    * Precondition:    None
+    * Postcondition:   The current pointer has moved by at most |steps| nodes and the signed distance moved is returned.
+    */
+    int move(int steps);
+
+    /*
+    * Return the position of the current pointer, counting the first node as 0. Head is -1 and tail is size().
+    * This is tracked by every operation, except that after an indexed search it is worked out on the next call.
+    * 
+    * Precondition:    None
+    * Postcondition:   The index of the current node is returned.
+    */
+    int position() const;
+
+    /*
+    * Move the current pointer to the node at the supplied index, walking from whichever end of the list is closer,
+    * so this costs O(min(index, size() - index)).
+    * 
+    * Precondition:    None
+    * Postcondition:   If 0 <= index < size(), current points to that node and true is returned. Otherwise nothing changes.
+    */
+    bool seek(int index);
     
     /*
     * Set the current pointer to the node containing the supplied data. Otherwise, nothing happens.
@@ -170,11 +402,41 @@ public:
     */    
     bool empty() const;
 
+    /*
+    * Return iterators over every data element, first to last. While the list is indexed (see hash_index.h), the
+    * data must not be changed through them.
+    * 
+    * Precondition:    None
+    * Postcondition:   A range from the first node up to tail is returned. Nothing in the list changes.
+    */
+    ItemRange<iterator> items();
+    ItemRange<const_iterator> items() const;
+
+    /*
+    * Return an iterator to the current element, which stays where it is however current moves afterwards.
+    * An exception is thrown if the list is empty or current is a sentinel node.
+    *
+    * Precondition:    The list is not empty and current is on a node.
+    * Postcondition:   An iterator to the current data element is returned. Nothing in the list changes.
+    */
+    const_iterator at_current() const;
+
 private:
+    void link_front(Node<T>* node);   // Link a new node in after head, updating the index and count
+    void link_back(Node<T>* node);    // Link a new node in before tail, updating the index and count
+
+    // Move the chain of count nodes from first to last out of source and in before the node before, updating
+    // both indexes and counts but neither current pointer
+    void move_chain(LinkedList& source, Node<T>* first, Node<T>* last, int count, Node<T>* before);
+
+    Alloc alloc;                   // Allocator used to create and destroy every Node, including the sentinels
+    Index index;                   // Index from data to the Nodes storing it, kept up to date by every mutator
     Node<T>* head;                 // Head of the list - sentinel node
     Node<T>* tail;                 // Tail of the list - sentinel node
     Node<T>* current;              // Current pointer
     int count;                     // Count of the Nodes in the list
+    mutable int current_index;     // Position of current, valid only while position_known is true
+    mutable bool position_known;   // False after an indexed search, until position() is next called
 };
 
 #include "linked_list.hpp"
@@ -5,86 +5,219 @@
  */
 
 #include "empty_collection_exception.h"
+#include <utility>
 
 // Constructor for LinkedList
 // Precondition:   None
 // Postcondition:  A new LinkedList is created, with all variables initialised.
-template <typename T>
-LinkedList<T>::LinkedList() : head(new Node<T>()), tail(new Node<T>()), count(0)
+template <typename T, typename Alloc, typename Index, typename Checks>
+LinkedList<T, Alloc, Index, Checks>::LinkedList(const Alloc &alloc) : alloc(alloc), head(this->alloc.create()), tail(this->alloc.create()), count(0)
 {
 	head->set_next(tail); // Set head's next to tail
 	tail->set_prev(head); // Set tail's previous to head
 	current = head;				// Set current to head
+	current_index = -1;		// Head sits before the first node
+	position_known = true;
 }
 
 // Destructor for LinkedList
 // Precondition:   None
 // Postcondition:  The LinkedList is destroyed and all associated memory is freed.
-template <typename T>
-LinkedList<T>::~LinkedList()
+template <typename T, typename Alloc, typename Index, typename Checks>
+LinkedList<T, Alloc, Index, Checks>::~LinkedList()
 {
 	clear();		 // Clear all nodes in the list
-	delete head; // Delete head node
-	delete tail; // Delete tail node
+	alloc.destroy(head); // Delete head node
+	alloc.destroy(tail); // Delete tail node
 }
 
 // Insert data at the front of the list
 // Precondition:   The supplied data is valid.
 // Postcondition:  The first data item is updated and current points to the new node.
-template <typename T>
-void LinkedList<T>::push_front(const T &data)
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::push_front(const T &data)
+{
+	link_front(alloc.create(data)); // Create a new node with a copy of the provided data
+}
+
+// Insert data at the front of the list, moving it into the new node
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated and data has been moved from.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::push_front(T &&data)
+{
+	link_front(alloc.create(std::move(data))); // Create a new node that takes over the provided data
+}
+
+// Construct a data element in place at the front of the list
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The first data item is updated.
+template <typename T, typename Alloc, typename Index, typename Checks>
+template <typename... Args>
+void LinkedList<T, Alloc, Index, Checks>::emplace_front(Args &&...args)
+{
+	link_front(alloc.create(node_emplace, std::forward<Args>(args)...)); // Build the data inside the new node
+}
+
+// Move a chain of nodes out of source and in before the node before
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::move_chain(LinkedList &source, Node<T> *first, Node<T> *last, int moved, Node<T> *before)
+{
+	if (Index::enabled) // Forget the chain in the source index, newest first, as most chains end the list
+	{
+		if (moved == source.count)
+			source.index.cleared();
+		else
+		{
+			for (Node<T> *node = last; node != first->get_prev(); node = node->get_prev())
+				source.index.unlinked(node);
+		}
+	}
+	first->get_prev()->set_next(last->get_next()); // Close the gap the chain leaves
+	last->get_next()->set_prev(first->get_prev());
+	source.count -= moved;
+
+	if (alloc != source.alloc) // Nodes must go back to the allocator that made them, so move the data instead
+	{
+		Node<T> *node = first;
+		for (int i = 0; i < moved; i++)
+		{
+			Node<T> *next = node->get_next();
+			Node<T> *copy = alloc.create(std::move(node->get_data()));
+			copy->set_prev(before->get_prev());
+			copy->set_next(before);
+			before->get_prev()->set_next(copy);
+			before->set_prev(copy);
+			if (before == tail)
+				index.linked_back(copy);
+			else
+				index.linked_after(copy);
+			source.alloc.destroy(node);
+			node = next;
+		}
+		count += moved;
+		return;
+	}
+
+	Node<T> *after = before->get_prev();
+	after->set_next(first);
+	first->set_prev(after);
+	last->set_next(before);
+	before->set_prev(last);
+	count += moved;
+	if (Index::enabled) // Record the chain in order: appended nodes are the newest matches, prepended the oldest
+	{
+		if (before == tail)
+		{
+			for (Node<T> *node = first; node != before; node = node->get_next())
+				index.linked_back(node);
+		}
+		else if (after == head)
+		{
+			for (Node<T> *node = last; node != head; node = node->get_prev())
+				index.linked_front(node);
+		}
+		else // Last first, so each node finds the later matches already recorded
+		{
+			for (Node<T> *node = last; node != after; node = node->get_prev())
+				index.linked_after(node);
+		}
+	}
+}
+
+// Link a new node in as the first data node
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::link_front(Node<T> *newNode)
 {
-	Node<T> *newNode = new Node<T>(data); // Create a new node with the provided data
 	newNode->set_next(head->get_next());	// Set new node's next to head's next
 	newNode->set_prev(head);							// Set new node's previous to head
 	head->get_next()->set_prev(newNode);	// Set head's next node's previous to new node
 	head->set_next(newNode);							// Set head's next to new node
+	index.linked_front(newNode);					// Record the new node in the index
+	if (current != head)									// Every node after head moved up one position
+		current_index++;
 	count++;															// Increment node count
 }
 
 // Insert data at the end of the list
 // Precondition:   The supplied data is valid.
 // Postcondition:  The last data item is updated and current points to the new node.
-template <typename T>
-void LinkedList<T>::push_back(const T &data)
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::push_back(const T &data)
+{
+	link_back(alloc.create(data)); // Create a new node with a copy of the provided data
+}
+
+// Insert data at the end of the list, moving it into the new node
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated and data has been moved from.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::push_back(T &&data)
+{
+	link_back(alloc.create(std::move(data))); // Create a new node that takes over the provided data
+}
+
+// Construct a data element in place at the end of the list
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The last data item is updated.
+template <typename T, typename Alloc, typename Index, typename Checks>
+template <typename... Args>
+void LinkedList<T, Alloc, Index, Checks>::emplace_back(Args &&...args)
+{
+	link_back(alloc.create(node_emplace, std::forward<Args>(args)...)); // Build the data inside the new node
+}
+
+// Link a new node in as the last data node
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::link_back(Node<T> *newNode)
 {
-	Node<T> *newNode = new Node<T>(data); // Create a new node with the provided data
 	newNode->set_next(tail);							// Set new node's next to tail
 	newNode->set_prev(tail->get_prev());	// Set new node's previous to tail's previous
 	tail->get_prev()->set_next(newNode);	// Set tail's previous node's next to new node
 	tail->set_prev(newNode);							// Set tail's previous to new node
+	index.linked_back(newNode);						// Record the new node in the index
+	if (current == tail)									// Tail moved up one position
+		current_index++;
 	count++;															// Increment node count
 }
 
 // Insert data before the current node
 // Precondition:   Current points to the node after the insertion point.
 // Postcondition:  A new node has been added and current points to the new node.
-template <typename T>
-void LinkedList<T>::insert(const T &data)
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::insert(const T &data)
 {
 	if (current == tail) // If current is tail, do nothing
 		return;
-	Node<T> *newNode = new Node<T>(data);		// Create a new node with the provided data
+	Node<T> *newNode = alloc.create(data);		// Create a new node with the provided data
 	newNode->set_next(current->get_next()); // Set new node's next to current's next
 	newNode->set_prev(current);							// Set new node's previous to current
 	current->get_next()->set_prev(newNode); // Set current's next node's previous to new node
 	current->set_next(newNode);							// Set current's next to new node
+	index.linked_after(newNode);						// Record the new node in the index
 	count++;																// Increment node count
 }
 
 // Remove the first data element from the list
 // Precondition:   The list is not empty.
 // Postcondition:  The first data element has been removed, reducing the count of Nodes by 1. Current points to head.
-template <typename T>
-T LinkedList<T>::pop_front()
+template <typename T, typename Alloc, typename Index, typename Checks>
+T LinkedList<T, Alloc, Index, Checks>::pop_front()
 {
-	if (empty()) // If list is empty, throw exception
+	if (Checks::enabled && empty()) // If list is empty, throw exception
 		throw empty_collection_exception();
 	Node<T> *toDelete = head->get_next(); // Node to be deleted is head's next
-	T data = toDelete->get_data();				// Retrieve data from node to be deleted
-	tail->set_prev(toDelete->get_prev()); // Set tail's previous to node to be deleted's previous
+	index.unlinked(toDelete);							// Forget the node in the index, while its data is intact
+	T data = std::move(toDelete->get_data()); // Move data out of node to be deleted
+	head->set_next(toDelete->get_next()); // Set head's next to node to be deleted's next
 	toDelete->get_next()->set_prev(head); // Set node to be deleted's next node's previous to head
-	delete toDelete;											// Delete node
+	if (current == toDelete)							// Never leave current on a deleted node
+		current = head;
+	if (current != head)									// Every node after head moved down one position
+		current_index--;
+	else
+		current_index = -1;
+	alloc.destroy(toDelete);							// Delete node
 	count--;															// Decrement node count
 	return data;													// Return data from deleted node
 }
@@ -92,16 +225,24 @@ T LinkedList<T>::pop_front()
 // Remove the last data element from the list
 // Precondition:   The list is not empty.
 // Postcondition:  The last data element has been removed, reducing the count of Nodes by 1. Current points to head.
-template <typename T>
-T LinkedList<T>::pop_back()
+template <typename T, typename Alloc, typename Index, typename Checks>
+T LinkedList<T, Alloc, Index, Checks>::pop_back()
 {
-	if (empty()) // If list is empty, throw exception
+	if (Checks::enabled && empty()) // If list is empty, throw exception
 		throw empty_collection_exception();
 	Node<T> *toDelete = tail->get_prev(); // Node to be deleted is tail's previous
-	T data = toDelete->get_data();				// Retrieve data from node to be deleted
+	index.unlinked(toDelete);							// Forget the node in the index, while its data is intact
+	T data = std::move(toDelete->get_data()); // Move data out of node to be deleted
 	tail->set_prev(toDelete->get_prev()); // Set tail's previous to node to be deleted's previous
 	toDelete->get_prev()->set_next(tail); // Set node to be deleted's previous node's next to tail
-	delete toDelete;											// Delete node
+	if (current == toDelete)							// Never leave current on a deleted node
+	{
+		current = head;
+		current_index = -1;
+	}
+	else if (current == tail)							// Tail moved down one position
+		current_index--;
+	alloc.destroy(toDelete);							// Delete node
 	count--;															// Decrement node count
 	return data;													// Return data from deleted node
 }
@@ -109,46 +250,170 @@ T LinkedList<T>::pop_back()
 // Remove the item pointed to by current from the list
 // Precondition:   The list is not empty and the current pointer is not pointing to a sentinel node.
 // Postcondition:  The data element pointed to by current has been removed, reducing the count of Nodes by 1. Current points to head.
-template <typename T>
-T LinkedList<T>::remove()
+template <typename T, typename Alloc, typename Index, typename Checks>
+T LinkedList<T, Alloc, Index, Checks>::remove()
 {
-	if (empty() || current == head || current == tail) // If list is empty or current is a sentinel node, throw exception
+	if (Checks::enabled && (empty() || current == head || current == tail)) // If list is empty or current is a sentinel node, throw exception
 		throw empty_collection_exception();
 	Node<T> *toDelete = current;													// Node to be deleted is current
-	T data = toDelete->get_data();												// Retrieve data from node to be deleted
+	index.unlinked(toDelete);															// Forget the node in the index, while its data is intact
+	T data = std::move(toDelete->get_data());							// Move data out of node to be deleted
 	toDelete->get_prev()->set_next(toDelete->get_next()); // Set node to be deleted's previous node's next to node to be deleted's next
 	toDelete->get_next()->set_prev(toDelete->get_prev()); // Set node to be deleted's next node's previous to node to be deleted's previous
 	current = toDelete->get_next();												// Move current to the next node
-	delete toDelete;																			// Delete node
+	alloc.destroy(toDelete);															// Delete node
 	count--;																							// Decrement node count
 	return data;																					// Return data from deleted node
 }
 
+// Remove every data element for which pred returns true, in one pass
+// Precondition:   pred can be called with a const T& and returns a value convertible to bool.
+// Postcondition:  The matching elements have been removed and their number is returned. Current stays on its node if that was kept, and otherwise points to head.
+template <typename T, typename Alloc, typename Index, typename Checks>
+template <typename Predicate>
+int LinkedList<T, Alloc, Index, Checks>::remove_if(Predicate pred)
+{
+	int removed = 0;
+	int position = 0; // Position of the node being looked at, once the earlier matches are gone
+	Node<T> *node = head->get_next();
+	while (node != tail)
+	{
+		Node<T> *next = node->get_next();
+		if (pred(static_cast<const T &>(node->get_data())))
+		{
+			index.unlinked(node);							 // Forget the node in the index, while its data is intact
+			node->get_prev()->set_next(next); // Unlink the node from its neighbours
+			next->set_prev(node->get_prev());
+			if (current == node) // Never leave current on a deleted node
+				current = head;
+			alloc.destroy(node);
+			removed++;
+		}
+		else
+		{
+			if (current == node)
+				current_index = position;
+			position++;
+		}
+		node = next;
+	}
+	count -= removed;
+	if (current == head)
+		current_index = -1;
+	else if (current == tail)
+		current_index = count;
+	position_known = true;
+	return removed;
+}
+
 // Clear all data elements from the list, leaving the sentinel nodes intact
 // Precondition:   None
 // Postcondition:  All data elements have been removed. Sentinels should not be removed. Count should be reset.
-template <typename T>
-void LinkedList<T>::clear()
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::clear()
 {
 	Node<T> *iter = head->get_next(); // Start iterating from head's next
 	while (iter != tail)
 	{
 		Node<T> *toDelete = iter; // Node to be deleted is current node
 		iter = iter->get_next();	// Move to the next node
-		delete toDelete;					// Delete current node
+		alloc.destroy(toDelete);	// Delete current node
 	}
 	head->set_next(tail); // Set head's next to tail
 	tail->set_prev(head); // Set tail's previous to head
+	index.cleared();			// Forget every node in the index
+	current = head;				// Current no longer points to a valid node
+	current_index = -1;
+	position_known = true;
 	count = 0;						// Reset node count
 }
 
+// Move every node of other onto the end of this list
+// Precondition:   other is not this list.
+// Postcondition:  The elements of other follow those of this list, and other is empty with current on head.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::append(LinkedList &&other)
+{
+	if (&other == this || other.empty())
+		return;
+	move_chain(other, other.head->get_next(), other.tail->get_prev(), other.count, tail);
+	if (current == tail) // Tail is always one past the last node
+		current_index = count;
+	other.current = other.head;
+	other.current_index = -1;
+	other.position_known = true;
+}
+
+// Move every node of other into this list before position
+// Precondition:   other is not this list, and position is an up to date cursor on this list.
+// Postcondition:  The elements of other are in this list before position, and other is empty with current on head.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::splice(const Cursor &position, LinkedList &other)
+{
+	if (&other == this || other.empty())
+		return;
+	Node<T> *before = const_cast<Node<T> *>(position.node); // The cursor only reads, but the nodes are this list's
+	int at = position.index;
+	if (before == head) // Stepped off the front, so insert before the first node
+	{
+		before = head->get_next();
+		at = 0;
+	}
+	int moved = other.count;
+	move_chain(other, other.head->get_next(), other.tail->get_prev(), moved, before);
+	if (current != head && position_known && current_index >= at) // Current was at or after the insertion point
+		current_index += moved;
+	other.current = other.head;
+	other.current_index = -1;
+	other.position_known = true;
+}
+
+// Move the node position is on and every node after it onto the end of rest
+// Precondition:   rest is not this list, and position is an up to date cursor on this list.
+// Postcondition:  This list ends before position and rest ends with the nodes that followed.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::split_at(const Cursor &position, LinkedList &rest)
+{
+	Node<T> *first = const_cast<Node<T> *>(position.node);
+	int at = position.index;
+	if (first == head) // Stepped off the front, so everything moves
+	{
+		first = head->get_next();
+		at = 0;
+	}
+	if (&rest == this || first == tail)
+		return;
+
+	int current_at = this->position(); // Worked out now if an indexed search left it unknown
+	rest.move_chain(*this, first, tail->get_prev(), count - at, rest.tail);
+	if (current == tail)
+		current_index = count;
+	else if (current != head && current_at >= at) // Current moved to rest
+	{
+		current = head;
+		current_index = -1;
+	}
+	if (rest.current == rest.tail)
+		rest.current_index = rest.count;
+}
+
+// Ask the allocator to set aside storage for n more nodes
+// Precondition:   None
+// Postcondition:  Up to n nodes can be added without the allocator requesting more memory, if it supports this.
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::reserve(int n)
+{
+	alloc.reserve(n);	 // Let the allocator decide how to set the storage aside
+	index.reserve(n > 0 ? static_cast<std::size_t>(count + n) : 0); // At most one value per node
+}
+
 // Return a reference to the first data element in the list - not the sentinel
 // Precondition:   The list is not empty.
 // Postcondition:  A reference to the first data element is returned.
-template <typename T>
-T &LinkedList<T>::front() const
+template <typename T, typename Alloc, typename Index, typename Checks>
+T &LinkedList<T, Alloc, Index, Checks>::front() const
 {
-	if (empty()) // If list is empty, throw exception
+	if (Checks::enabled && empty()) // If list is empty, throw exception
 		throw empty_collection_exception();
 	return head->get_next()->get_data(); // Return data of head's next node
 }
@@ -156,10 +421,10 @@ T &LinkedList<T>::front() const
 // Return a reference to the last data element in the list - not the sentinel
 // Precondition:   The list is not empty.
 // Postcondition:  A reference to the last data element is returned.
-template <typename T>
-T &LinkedList<T>::back() const
+template <typename T, typename Alloc, typename Index, typename Checks>
+T &LinkedList<T, Alloc, Index, Checks>::back() const
 {
-	if (empty()) // If list is empty, throw exception
+	if (Checks::enabled && empty()) // If list is empty, throw exception
 		throw empty_collection_exception();
 	return tail->get_prev()->get_data(); // Return data of tail's previous node
 }
@@ -167,10 +432,10 @@ T &LinkedList<T>::back() const
 // Return a reference to the data element pointed to by current
 // Precondition:   The list is not empty and the current pointer is not pointing to a sentinel node.
 // Postcondition:  A reference to the current data element is returned.
-template <typename T>
-T &LinkedList<T>::get_current() const
+template <typename T, typename Alloc, typename Index, typename Checks>
+T &LinkedList<T, Alloc, Index, Checks>::get_current() const
 {
-	if (empty() || current == head || current == tail) // If list is empty or current is a sentinel node, throw exception
+	if (Checks::enabled && (empty() || current == head || current == tail)) // If list is empty or current is a sentinel node, throw exception
 		throw empty_collection_exception();
 	return current->get_data(); // Return data of current node
 }
@@ -178,46 +443,115 @@ T &LinkedList<T>::get_current() const
 // Set the current pointer to the node after head, even if this is tail
 // Precondition:   None
 // Postcondition:  The current pointer is set to the node after head.
-template <typename T>
-void LinkedList<T>::begin()
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::begin()
 {
 	current = head->get_next(); // Set current to head's next node
+	current_index = 0;
+	position_known = true;
 }
 
 // Set the current pointer to the node before tail head, even if this is head
 // Precondition:   None
 // Postcondition:  The current pointer is set to the node before tail.
-template <typename T>
-void LinkedList<T>::end()
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::end()
 {
 	current = tail->get_prev(); // Set current to tail's previous node
+	current_index = count - 1;
+	position_known = true;
 }
 
 // Move the current pointer forward, if valid. Otherwise, nothing happens
 // Precondition:   None
 // Postcondition:  The current pointer is set to the next node, if applicable.
-template <typename T>
-void LinkedList<T>::forward()
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::forward()
 {
 	if (current != tail && current->get_next() != tail) // If current is not tail and current's next is not tail
+	{
 		current = current->get_next();										// Move current to the next node
+		current_index++;
+	}
 }
 
 // Move the current pointer backward, if valid. Otherwise, nothing happens
 // Precondition:   None
 // Postcondition:  The current pointer is set to the previous node, if applicable.
-template <typename T>
-void LinkedList<T>::backward()
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::backward()
 {
-	if (current != head->get_next() && current->get_prev() != head) // If current is not head's next node
+	if (current != head && current != head->get_next() && current->get_prev() != head) // If current is not head or head's next node
+	{
 		current = current->get_prev(); // Move current to the previous node
+		current_index--;
+	}
+}
+
+// Move the current pointer by the given number of nodes, stopping at the first or last node
+// Precondition:   None
+// Postcondition:  The current pointer has moved by at most steps nodes and the signed distance moved is returned.
+template <typename T, typename Alloc, typename Index, typename Checks>
+int LinkedList<T, Alloc, Index, Checks>::move(int steps)
+{
+	int moved = 0;
+	while (moved < steps && current != tail && current->get_next() != tail) // Walk forward, but never onto tail
+	{
+		current = current->get_next();
+		moved++;
+	}
+	while (moved > steps && current != head && current->get_prev() != head) // Walk backward, but never onto head
+	{
+		current = current->get_prev();
+		moved--;
+	}
+	current_index += moved; // Only meaningful if the position was already known
+	return moved;
+}
+
+// Return the position of the current pointer
+// Precondition:   None
+// Postcondition:  The index of the current node is returned, with -1 for head and size() for tail.
+template <typename T, typename Alloc, typename Index, typename Checks>
+int LinkedList<T, Alloc, Index, Checks>::position() const
+{
+	if (!position_known) // Lost after an indexed search, so count the nodes before current
+	{
+		int steps = -1;
+		for (const Node<T> *node = current; node != head; node = node->get_prev())
+			steps++;
+		current_index = steps;
+		position_known = true;
+	}
+	return current_index;
+}
+
+// Move the current pointer to the node at index
+// Precondition:   None
+// Postcondition:  If 0 <= index < size(), current points to that node and true is returned. Otherwise nothing changes.
+template <typename T, typename Alloc, typename Index, typename Checks>
+bool LinkedList<T, Alloc, Index, Checks>::seek(int index)
+{
+	if (index < 0 || index >= count) // If index is out of range, do nothing
+		return false;
+	if (index < count / 2) // Closer to head, so walk forward from the first node
+	{
+		begin();
+		move(index);
+	}
+	else // Closer to tail, so walk backward from the last node
+	{
+		end();
+		move(index - (count - 1));
+	}
+	return true;
 }
 
 // Return the count of the number of nodes in the list, excluding sentinels
 // Precondition:   None
 // Postcondition:  The number of (true) nodes is returned.
-template <typename T>
-int LinkedList<T>::size() const
+template <typename T, typename Alloc, typename Index, typename Checks>
+int LinkedList<T, Alloc, Index, Checks>::size() const
 {
 	return count; // Return node count
 }
@@ -225,8 +559,8 @@ int LinkedList<T>::size() const
 // Return true if the list is empty, false otherwise
 // Precondition:   None
 // Postcondition:  None
-template <typename T>
-bool LinkedList<T>::empty() const
+template <typename T, typename Alloc, typename Index, typename Checks>
+bool LinkedList<T, Alloc, Index, Checks>::empty() const
 {
 	return count == 0; // Return true if count is 0, otherwise false
 }
@@ -234,18 +568,128 @@ bool LinkedList<T>::empty() const
 // Set the current pointer to the node containing the supplied data. Otherwise, nothing happens
 // Precondition:   None
 // Postcondition:  current points to the first node storing the target, and true is returned.
-template <typename T>
-bool LinkedList<T>::search(const T &target)
+template <typename T, typename Alloc, typename Index, typename Checks>
+bool LinkedList<T, Alloc, Index, Checks>::search(const T &target)
 {
+	if (Index::enabled) // Let the index find the first match directly
+	{
+		Node<T> *found = index.find(target);
+		BROWSER_STAT(STAT_SEARCHES, 1);
+		if (found == nullptr)
+			return false;
+		current = found;
+		position_known = false; // The index does not know positions, so work it out only if asked
+		return true;
+	}
+
 	Node<T> *node = head->get_next(); // Start searching from head's next node
+	int position = 0;
 	while (node != tail)
 	{
 		if (node->get_data() == target) // If node's data matches target
 		{
 			current = node; // Set current to the found node
+			current_index = position;
+			position_known = true;
+			BROWSER_STAT(STAT_SEARCHES, 1);
+			BROWSER_STAT(STAT_SEARCH_COMPARISONS, position + 1);
 			return true;		// Return true
 		}
 		node = node->get_next(); // Move to the next node
+		position++;
 	}
+	BROWSER_STAT(STAT_SEARCHES, 1);
+	BROWSER_STAT(STAT_SEARCH_COMPARISONS, position);
 	return false; // Return false if target not found
-}
\ No newline at end of file
+}
+// Return iterators from the first node up to tail
+// Precondition:   None
+// Postcondition:  A range over every data element is returned.
+template <typename T, typename Alloc, typename Index, typename Checks>
+ItemRange<typename LinkedList<T, Alloc, Index, Checks>::iterator> LinkedList<T, Alloc, Index, Checks>::items()
+{
+	return ItemRange<iterator>(iterator(head->get_next()), iterator(tail));
+}
+
+// Return const iterators from the first node up to tail
+// Precondition:   None
+// Postcondition:  A range over every data element is returned.
+template <typename T, typename Alloc, typename Index, typename Checks>
+ItemRange<typename LinkedList<T, Alloc, Index, Checks>::const_iterator> LinkedList<T, Alloc, Index, Checks>::items() const
+{
+	return ItemRange<const_iterator>(const_iterator(head->get_next()), const_iterator(tail));
+}
+
+// Return an iterator to the current node
+// Precondition:   The list is not empty and current is on a node.
+// Postcondition:  An iterator to the current data element is returned.
+template <typename T, typename Alloc, typename Index, typename Checks>
+typename LinkedList<T, Alloc, Index, Checks>::const_iterator LinkedList<T, Alloc, Index, Checks>::at_current() const
+{
+	if (Checks::enabled && (empty() || current == head || current == tail)) // As for get_current
+		throw empty_collection_exception();
+	return const_iterator(current);
+}
+
+// ---- Cursor --------
+
+// Constructor for Cursor
+// Precondition:   list outlives the cursor.
+// Postcondition:  The cursor is on the first element, or on tail if the list is empty.
+template <typename T, typename Alloc, typename Index, typename Checks>
+LinkedList<T, Alloc, Index, Checks>::Cursor::Cursor(const LinkedList &list)
+		: list(&list), node(list.head->get_next()), index(0)
+{
+}
+
+// Move the cursor to the first element
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::Cursor::begin()
+{
+	node = list->head->get_next();
+	index = 0;
+}
+
+// Move the cursor to the last element
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::Cursor::end()
+{
+	node = list->tail->get_prev();
+	index = list->count - 1;
+}
+
+// Move the cursor to the next element, stopping on tail
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::Cursor::forward()
+{
+	if (node != list->tail)
+	{
+		node = node->get_next();
+		index++;
+	}
+}
+
+// Move the cursor to the previous element, stopping on head
+template <typename T, typename Alloc, typename Index, typename Checks>
+void LinkedList<T, Alloc, Index, Checks>::Cursor::backward()
+{
+	if (node != list->head)
+	{
+		node = node->get_prev();
+		index--;
+	}
+}
+
+// Return true if the cursor is on an element rather than a sentinel
+template <typename T, typename Alloc, typename Index, typename Checks>
+bool LinkedList<T, Alloc, Index, Checks>::Cursor::valid() const
+{
+	return node != list->head && node != list->tail;
+}
+
+// Return the element the cursor is on
+template <typename T, typename Alloc, typename Index, typename Checks>
+const T &LinkedList<T, Alloc, Index, Checks>::Cursor::get_current() const
+{
+	return node->get_data();
+}
@@ -9,231 +9,168 @@
 
 #include <iostream>
 #include <cstdio>
-#include <sstream>
+#include <charconv>
 #include <fstream>
-#include <vector>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <string>
+#include <string_view>
 
 #include "browser.h"
+#include "commands.h"
+#include "journal.h"
+#include "output_buffer.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "stats.h"
 
 /*
-* Display a welcome message.
+* Options for file mode, set from the command line.
 */
-static void show_welcome() 
+struct ReplayOptions
 {
-    std::cout
-    << "===========================[ Browser ]=========================" << std::endl 
-    << "                 Welcome to the SENG1120 Browser!              " << std::endl 
-    << "                 Enter ? for a list of commands.               " << std::endl 
-    << "===============================================================" << std::endl
-    << std::endl;
-}
+    bool buffered;  //--buffered: collect output in a large buffer, written when full and at the end
+    bool summary;   //--summary: print only the final state and a summary
+    bool sessions;  //--sessions: each line starts with a session id, and sessions are replayed in parallel
+    int threads;    //--threads N: number of worker threads for --sessions
+    bool stats;     //--stats: time every command and count list operations, printed to stderr at exit
+    char* load;     //--load FILE: start from the browser saved in a snapshot instead of the homepage
+    char* save;     //--save FILE: save the browser to a snapshot before exiting
+    char* journal;  //--journal FILE: recover the browser from a journal and journal every change to it
+    bool sync;      //--journal-sync: sync the journal to disk after every batch
+};
 
 /*
-* Display a the help menu.
+* Restore a browser from the snapshot named by --load, if any. Return false, after printing why, if it fails.
 */
-void show_help()
+static bool load_snapshot(Browser& browser, const ReplayOptions& options)
 {
-    std::cout
-    << "============================================[ Commands ]============================================" << std::endl 
-    << "  v [url]" << std::endl 
-    << "      Visit the specified URL." << std::endl 
-    << "  < [steps]" << std::endl 
-    << "      Move backward the specified number of steps." << std::endl 
-    << "  > [steps]" << std::endl 
-    << "      Move forward the specified number of steps." << std::endl 
-    << "  r [url]" << std::endl 
-    << "      Remove all history entries for the given URL." << std::endl 
-    << "  b" << std::endl 
-    << "      Bookmark/unbookmark the current URL. " << std::endl 
-    << "  c" << std::endl 
-    << "      Clear the history, resetting to the homepage." << std::endl 
-    << "  p" << std::endl 
-    << "      Prints the bookmark list." << std::endl 
-    << "  H" << std::endl 
-    << "      Counts the number of elements in the history list." << std::endl 
-    << "  B" << std::endl 
-    << "      Counts the number of elements in the bookmark list." << std::endl 
-    << "  V [index]" << std::endl 
-    << "      Visits the bookmark with specified index, if it exists." << std::endl 
-    << "  q" << std::endl 
-    << "      Quit." << std::endl 
-    << "  ?" << std::endl 
-    << "      Show this help menu." << std::endl 
-    << "=====================================================================================================" << std::endl ;
+    if (options.load == nullptr)
+    {
+        return true;
+    }
+    try
+    {
+        BrowserSnapshot::load(browser, options.load);
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
 }
 
 /*
-* Present the user with a prompt, returning the user's input command
+* Save a browser to the snapshot named by --save, if any. Return false, after printing why, if it fails.
 */
-std::string prompt() 
+static bool save_snapshot(const Browser& browser, const ReplayOptions& options)
 {
-    std::string command;
-    std::cout << "Enter command: ";
-    //read entire line from cin, not just next token
-    std::getline(std::cin, command);
-
-    return command;
+    if (options.save == nullptr)
+    {
+        return true;
+    }
+    try
+    {
+        BrowserSnapshot::save(browser, options.save);
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
 }
 
 /*
-* Break a command into a vector of tokens (i.e., split by space)
+* Recover a browser from the journal named by --journal, if any, and keep journaling it. Return false, after
+* printing why, if it fails.
 */
-std::vector<std::string> parse_command(const std::string& command)
+static bool open_journal(Browser& browser, const ReplayOptions& options, std::unique_ptr<BrowserJournal>& journal)
 {
-    std::vector<std::string> tokens;
-
-    std::istringstream iss(command);
-    std::string s;
-
-    while (std::getline(iss, s, ' ')) 
+    if (options.journal == nullptr)
     {
-        tokens.push_back(s);
+        return true;
+    }
+    try
+    {
+        JournalOptions journal_options = { options.sync, JOURNAL_BATCH_BYTES, JOURNAL_COMPACT_BYTES };
+        journal.reset(new BrowserJournal(browser, options.journal, journal_options));
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
     }
-
-    return tokens;
 }
 
 /*
-* Return the integer for a command of the form <command> <integer>.
+* Write the changes journaled so far, if there is a journal. With finish, also wait for any compaction.
+* Return false, after printing why, if it fails.
 */
-int parse_int_command(const std::string& command)
+static bool commit_journal(BrowserJournal* journal, bool finish)
 {
-    std::vector<std::string> tokens = parse_command(command);
-    if (tokens.size() != 2) 
+    if (journal == nullptr)
     {
-        throw std::invalid_argument("Invalid command. Command must have only 2 tokens, you provided: " + tokens.size());
+        return true;
     }
-
     try
     {
-        //tokens[0] is the command, which we can ignore
-        int value = std::stoi(tokens[1]);
-        return value;
+        journal->commit();
+        if (finish)
+        {
+            journal->wait();
+        }
+        return true;
     }
-    catch(std::exception& e)
+    catch(const std::exception& e)
     {
-        throw std::invalid_argument("Error parsing integer in command.");
+        std::cerr << e.what() << std::endl;
+        return false;
     }
-    
 }
 
 /*
-* Return the integer for a command of the form <command> <integer>.
+* Display a welcome message.
 */
-std::string parse_string_command(const std::string& command)
+static void show_welcome() 
 {
-    std::vector<std::string> tokens = parse_command(command);
-    if (tokens.size() != 2) 
-    {
-        throw std::invalid_argument("Invalid command. Command must have only 2 tokens, you provided: " + tokens.size());
-    }
-
-    //tokens[0] is the command, which we can ignore
-    return tokens[1];    
+    std::cout
+    << "===========================[ Browser ]=========================" << std::endl 
+    << "                 Welcome to the SENG1120 Browser!              " << std::endl 
+    << "                 Enter ? for a list of commands.               " << std::endl 
+    << "===============================================================" << std::endl
+    << std::endl;
 }
 
 /*
-* Helper method to determine the method to execute based on the command.
-* The return value determines whether to continue execution.
+* Present the user with a prompt, returning the user's input command
 */
-bool execute_command(Browser& browser, const std::string& command)
+std::string prompt() 
 {
-    char cmd = command[0]; //the first character is the command code
-
-    switch (cmd)
-    {
-    case 'v':
-        try
-        {
-            std::string url = parse_string_command(command);
-            browser.visit(url);
-        }
-        catch(const std::exception& e)
-        {
-            std::cerr << e.what() << '\n';
-        }
-        break;
-    case '<':
-        try
-        {
-            int steps = parse_int_command(command);
-            browser.back(steps);
-        }
-        catch(const std::exception& e)
-        {
-            std::cerr << e.what() << '\n';
-        }
-        break;
-    case '>':
-        try
-        {
-            int steps = parse_int_command(command);
-            browser.forward(steps);
-        }
-        catch(const std::exception& e)
-        {
-            std::cerr << e.what() << '\n';
-        }
-        break;
-    case 'r':
-        try
-        {
-            std::string url = parse_string_command(command);
-            browser.remove(url);
-        }
-        catch(const std::exception& e)
-        {
-            std::cerr << e.what() << '\n';
-        }
-        break;
-    case 'b':
-        browser.bookmark_current();
-        break;
-    case 'c':
-        browser.clear_history();
-        break;
-    case 'p':
-        browser.print_bookmarks();
-        break;
-    case 'H':
-        std::cout << "Number of elements in history: " << browser.count_history() << std::endl;
-        break;
-    case 'B':
-        std::cout << "Number of elements in bookmarks: " << browser.count_bookmarks() << std::endl;
-        break;
-    case 'V':
-        try
-        {
-            int index = parse_int_command(command);
-            browser.visit_bookmark(index);
-        }
-        catch(const std::exception& e)
-        {
-            std::cerr << e.what() << '\n';
-        }
-        break;
-    case 'q':
-        return false; //used to flag that we want to exit
-        break;
-    case '?':
-        show_help();
-        break;
-    default:
-        std::cout << "Unknown command: " << command << std::endl;
-        break;
-    }
+    std::string command;
+    std::cout << "Enter command: ";
+    //read entire line from cin, not just next token
+    std::getline(std::cin, command);
 
-    return true;
+    return command;
 }
 
 /*
 * Run the program in prompt (interactive) mode, where the commands are supplied by the user.
 */
-void run_prompt_mode()
+bool run_prompt_mode(const ReplayOptions& options)
 {
-    show_welcome();
-
     Browser browser;
+    std::unique_ptr<BrowserJournal> journal;
+    if (!load_snapshot(browser, options) || !open_journal(browser, options, journal))
+    {
+        return false;
+    }
+
+    show_welcome();
 
     bool do_continue = true;
     // Here, we have a valid reason for a do-while loop
@@ -244,53 +181,236 @@ void run_prompt_mode()
         //write the current site, prompt, execute, write newline
         std::cout << "Current site: " << browser.get_current_site() << std::endl;
         std::string command = prompt();
-        do_continue = execute_command(browser, command);
+        do_continue = execute_command(browser, command, std::cout, std::cerr);
         std::cout << std::endl;
+        //each command is on disk before the next prompt
+        if (!commit_journal(journal.get(), !do_continue))
+        {
+            return false;
+        }
     } while(do_continue);
+
+    return save_snapshot(browser, options);
 }
 
 /*
 * Run the program in file mode, where the input commands are read from a file.
+* With --buffered, standard output is byte-for-byte the same but is written in large blocks; errors still go
+* straight to standard error, so they are no longer interleaved with the output at the point they occurred.
+* With --summary, the output and errors of each command are dropped and a summary is printed at the end.
+* With --journal the changes are written in batches as they are made, and all of them by the end; the journal is
+* compacted whenever a batch takes its segment past JOURNAL_COMPACT_BYTES, without waiting for the end.
+* Return false if a snapshot or journal could not be read or written.
 */
-void run_file_mode(char* file_name)
+bool run_file_mode(char* file_name, const ReplayOptions& options)
 {
     Browser browser;
+    std::unique_ptr<BrowserJournal> journal;
+    if (!load_snapshot(browser, options) || !open_journal(browser, options, journal))
+    {
+        return false;
+    }
 
     std::ifstream infile(file_name);
     std::string command;
 
+    std::streambuf* out = std::cout.rdbuf();
+    std::streambuf* err = std::cerr.rdbuf();
+    OutputBuffer buffer(out);
+    DiscardBuffer discarded_out;
+    DiscardBuffer discarded_err;
+    if (options.buffered)
+    {
+        std::cout.rdbuf(&buffer);
+    }
+    if (options.summary)
+    {
+        std::cout.rdbuf(&discarded_out);
+        std::cerr.rdbuf(&discarded_err);
+    }
+
+    long commands = 0;
     bool do_continue = true;
     //exit if we run out of lines, or encounter the quit command
     while(std::getline(infile, command) && do_continue)
     {
-        std::cout << "Current site: " << browser.get_current_site() << std::endl;
-        //remove the newline character
-        command = command.substr(0, command.length() - 1);
-        std::cout << "Executing command: " << command << std::endl;
-        do_continue = execute_command(browser, command);
-        std::cout << std::endl;
+        commands++;
+        //remove the newline character, without copying the rest of the line
+        if (!command.empty())
+        {
+            command.pop_back();
+        }
+        do_continue = replay_command(browser, command, std::cout, std::cerr);
+    }
+
+    if (options.summary)
+    {
+        std::cout.rdbuf(options.buffered ? &buffer : out);
+        std::cerr.rdbuf(err);
     }
 
     std::cout << "Current site: " << browser.get_current_site() << std::endl;
+
+    if (options.summary)
+    {
+        std::cout << "Commands executed: " << commands << std::endl;
+        std::cout << "Errors reported: " << discarded_err.lines() << std::endl;
+        std::cout << "Number of elements in history: " << browser.count_history() << std::endl;
+        std::cout << "Number of elements in bookmarks: " << browser.count_bookmarks() << std::endl;
+        browser.print_bookmarks();
+    }
+
+    std::cout.rdbuf(out);
+    buffer.flush();
+
+    return commit_journal(journal.get(), true) && save_snapshot(browser, options);
+}
+
+/*
+* Run the program in session mode, where each line of the file is <session id> <command>.
+* Every session is replayed in a browser of its own, spread over options.threads worker threads, and the
+* output of each session is printed together, in order of first appearance.
+*/
+void run_session_mode(char* file_name, const ReplayOptions& options)
+{
+    std::ifstream infile(file_name, std::ios::binary);
+    std::ostringstream contents;
+    contents << infile.rdbuf();
+    std::string trace = contents.str();
+
+    SessionReplay replay(trace);
+
+    std::streambuf* out = std::cout.rdbuf();
+    OutputBuffer buffer(out);
+    if (options.buffered)
+    {
+        std::cout.rdbuf(&buffer);
+    }
+
+    ReplayTotals totals = replay.run(options.threads, std::cout, std::cerr, options.summary);
+
+    if (options.summary)
+    {
+        std::cout << "Sessions replayed: " << totals.sessions << std::endl;
+        std::cout << "Commands executed: " << totals.commands << std::endl;
+        std::cout << "Errors reported: " << totals.errors << std::endl;
+    }
+
+    std::cout.rdbuf(out);
+    buffer.flush();
 }
 
 /*
 * The main method. When no arguments are supplied, run in interactive mode. 
-* When one argument is supplied, it is assumed to be a valid file of commands, one per line.
+* When a file is supplied, it is assumed to be a valid file of commands, one per line.
+* The options --buffered and --summary, which may come before the file, change how file mode prints.
+* With --sessions the file is a multi-session trace, replayed on --threads N threads (default: one per core).
+* With --stats, which needs a build with -DBROWSER_STATS, statistics are printed to standard error at exit.
+* With --load the browser starts from a snapshot, and with --save it is saved to one before exiting; neither
+* can be used with --sessions. With --journal the browser is recovered from a journal and every change to it is
+* journaled, synced to disk after every batch with --journal-sync; it cannot be used with the other three.
 */
 int main(int argc, char* argv[])
 {
-    if(argc > 1)
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    ReplayOptions options = { false, false, false, cores > 0 ? cores : 1, false, nullptr, nullptr, nullptr, false };
+    char* file_name = nullptr;
+    for (int i = 1; i < argc; i++)
     {
-        std::cout << "Using file " << argv[1] << " as input." << std::endl << std::endl;
-        run_file_mode(argv[1]);
+        std::string_view arg = argv[i];
+        if (arg == "--buffered")
+        {
+            options.buffered = true;
+        }
+        else if (arg == "--summary")
+        {
+            options.summary = true;
+        }
+        else if (arg == "--sessions")
+        {
+            options.sessions = true;
+        }
+        else if (arg == "--stats")
+        {
+            options.stats = true;
+        }
+        else if (arg == "--journal-sync")
+        {
+            options.sync = true;
+        }
+        else if ((arg == "--load" || arg == "--save") && i + 1 < argc)
+        {
+            (arg == "--load" ? options.load : options.save) = argv[++i];
+        }
+        else if (arg == "--journal" && i + 1 < argc)
+        {
+            options.journal = argv[++i];
+        }
+        else if (arg == "--threads" && i + 1 < argc
+                 && std::from_chars(argv[i + 1], argv[i + 1] + std::string_view(argv[i + 1]).size(), options.threads).ec == std::errc()
+                 && options.threads > 0)
+        {
+            i++;
+        }
+        else if (file_name == nullptr && arg.substr(0, 2) != "--")
+        {
+            file_name = argv[i];
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--buffered] [--summary] [--sessions [--threads N]] [--stats]\n"
+                      << "       [--load SNAPSHOT] [--save SNAPSHOT] [--journal PATH [--journal-sync]] [command file]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (options.sessions && (options.load != nullptr || options.save != nullptr))
+    {
+        std::cerr << "--load and --save cannot be used with --sessions." << std::endl;
+        return 1;
+    }
+    if (options.journal != nullptr && (options.sessions || options.load != nullptr || options.save != nullptr))
+    {
+        std::cerr << "--journal cannot be used with --sessions, --load or --save." << std::endl;
+        return 1;
+    }
+    if (options.sync && options.journal == nullptr)
+    {
+        std::cerr << "--journal-sync needs --journal." << std::endl;
+        return 1;
+    }
+
+    BrowserStats::enable(options.stats);
+
+    bool ok = true;
+    if(file_name != nullptr)
+    {
+        std::cout << "Using file " << file_name << " as input." << std::endl << std::endl;
+        if (options.sessions)
+        {
+            run_session_mode(file_name, options);
+        }
+        else
+        {
+            ok = run_file_mode(file_name, options);
+        }
+    }
+    else if (options.buffered || options.summary || options.sessions)
+    {
+        std::cerr << "--buffered, --summary and --sessions need a command file." << std::endl;
+        return 1;
     }
     else
     {
-        run_prompt_mode();
+        ok = run_prompt_mode(options);
     }
 
     std::cout << "Goodbye!" << std::endl;
+
+    if (options.stats)
+    {
+        BrowserStats::print(std::cerr);
+    }
     
-    return 0;
+    return ok ? 0 : 1;
 }
\ No newline at end of file
@@ -11,6 +11,12 @@
 #ifndef SENG1120_NODE_H
 #define SENG1120_NODE_H
 
+#include <utility>
+
+// Tag that selects the Node constructor which builds its data in place from the remaining arguments
+struct node_emplace_t {};
+const node_emplace_t node_emplace = node_emplace_t();
+
 template <typename T>
 class Node
 {
@@ -28,6 +34,19 @@ public:
     */
 	Node(const T& new_data);
 
+	/*
+    * Precondition:    None
+    * Postcondition:   A new Node is created by moving the supplied data into it, next and prev are initialised.
+    */
+	Node(T&& new_data);
+
+	/*
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   A new Node is created with its data constructed in place from args, next and prev are initialised.
+    */
+	template <typename... Args>
+	Node(node_emplace_t, Args&&... args);
+
 	/*
     * Precondition:    None
     * Postcondition:   The Node is destroyed and all associated memory is freed.
@@ -6,41 +6,36 @@
 
 // Default constructor for Node, initializes data to its default value and next and prev pointers to nullptr
 template <typename T>
-Node<T>::Node()
+Node<T>::Node() : data(), next(nullptr), prev(nullptr)
 {
 	// The constructor initializes the node with default values.
-	// The data member of the node is initialized with the default value of the type T.
-
-	// Initialize data to its default value
-	data = T();
+	// The data member of the node is value-initialized, which gives the default value of the type T.
 
 	// The next and previous pointers of the node are initialized to nullptr,
 	// indicating that the node does not point to any other node in the list.
-
-	// Initialize next pointer to nullptr
-	next = nullptr;
-
-	// Initialize previous pointer to nullptr
-	prev = nullptr;
 }
 
 template <typename T>
-Node<T>::Node(const T &new_data)
+Node<T>::Node(const T &new_data) : data(new_data), next(nullptr), prev(nullptr)
 {
 	// This is an overloaded constructor that initializes the node with a given value.
-	// The data member of the node is initialized with the value passed as an argument.
-
-	// Initialize data to new_data
-	data = new_data;
-
-	// The next and previous pointers of the node are initialized to nullptr,
-	// indicating that the node does not point to any other node in the list.
+	// The data member is copy-constructed from the argument directly, rather than
+	// being default-constructed first and then assigned.
+}
 
-	// Initialize next pointer to nullptr
-	next = nullptr;
+template <typename T>
+Node<T>::Node(T &&new_data) : data(std::move(new_data)), next(nullptr), prev(nullptr)
+{
+	// This overloaded constructor takes over the resources of a temporary (or moved) value,
+	// so no copy of the data is made.
+}
 
-	// Initialize previous pointer to nullptr
-	prev = nullptr;
+template <typename T>
+template <typename... Args>
+Node<T>::Node(node_emplace_t, Args &&...args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr)
+{
+	// This overloaded constructor builds the data in place from the supplied constructor arguments,
+	// so the data is constructed exactly once.
 }
 template <typename T>
 Node<T>::~Node()
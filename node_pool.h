@@ -0,0 +1,129 @@
+/*
+* node_pool.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This file contains the allocator policies that a LinkedList uses to obtain and release its Nodes.
+* NodePool recycles Node storage through a free list backed by contiguous chunks, while HeapAllocator
+* uses plain new/delete for every Node.
+*/
+
+#ifndef SENG1120_NODE_POOL_H
+#define SENG1120_NODE_POOL_H
+
+#include "node.h"
+#include "stats.h"
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+template <typename T>
+class NodePool
+{
+public:
+
+    /*
+    * Precondition:    chunk_size is greater than 0.
+    * Postcondition:   A new, empty pool is created. The first chunk holds chunk_size Nodes; later chunks double in size.
+    */
+    NodePool(int chunk_size = 32);
+
+    /*
+    * Create a Node from the supplied constructor arguments (see node.h), using a recycled slot if one is available.
+    *
+    * Precondition:    args are valid arguments for a constructor of Node<T>.
+    * Postcondition:   A new Node is returned, with next and prev initialised.
+    */
+    template <typename... Args>
+    Node<T>* create(Args&&... args);
+
+    /*
+    * Destroy a Node and return its slot to the free list. The memory is kept by the pool for reuse.
+    *
+    * Precondition:    node was created by this pool (or a copy of it) and has not already been destroyed.
+    * Postcondition:   The Node is destroyed and its slot is available to the next call to create.
+    */
+    void destroy(Node<T>* node);
+
+    /*
+    * Set aside storage so that at least n more Nodes can be created without allocating.
+    *
+    * Precondition:    None
+    * Postcondition:   The next n calls to create are served from storage that already exists.
+    */
+    void reserve(int n);
+
+    /*
+    * Return true if both pools share the same storage, so that a Node created by one may be destroyed by the other.
+    *
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    bool operator==(const NodePool<T>& other) const;
+    bool operator!=(const NodePool<T>& other) const;
+
+private:
+    // A slot is either free (and links to the next free slot) or holds a live Node
+    union Slot
+    {
+        Slot* next_free;
+        typename std::aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type storage;
+    };
+
+    // The storage shared by every copy of a pool. Chunks are released when the last copy is destroyed.
+    struct Arena
+    {
+        Arena(int chunk_size);
+        ~Arena();
+
+        std::vector<Slot*> chunks;   // Every chunk allocated so far
+        Slot* free_list;             // Slots returned by destroy, most recent first
+        Slot* bump;                  // Next never-used slot in the newest chunk
+        Slot* bump_end;              // One past the last slot of the newest chunk
+        int next_chunk_size;         // Number of slots in the next chunk to be allocated
+    };
+
+    void* allocate();                // Return storage for one Node, growing the arena if required
+
+    std::shared_ptr<Arena> arena;    // Storage shared by copies of this pool
+};
+
+template <typename T>
+class HeapAllocator
+{
+public:
+
+    /*
+    * Precondition:    args are valid arguments for a constructor of Node<T>.
+    * Postcondition:   A new Node built from args is allocated with new.
+    */
+    template <typename... Args>
+    Node<T>* create(Args&&... args);
+
+    /*
+    * Precondition:    node was allocated with new.
+    * Postcondition:   The Node is deleted.
+    */
+    void destroy(Node<T>* node);
+
+    /*
+    * Heap allocators allocate every Node separately, so this does nothing.
+    *
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    void reserve(int n);
+
+    /*
+    * Heap allocators are interchangeable, so this always returns true.
+    *
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    bool operator==(const HeapAllocator<T>& other) const;
+    bool operator!=(const HeapAllocator<T>& other) const;
+};
+
+#include "node_pool.hpp"
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * node_pool.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include <new>
+#include <utility>
+
+// Largest number of slots in a single chunk, so a long list never requests one huge block
+const int NODE_POOL_MAX_CHUNK = 4096;
+
+// ---- NodePool --------
+
+template <typename T>
+NodePool<T>::Arena::Arena(int chunk_size)
+		: free_list(nullptr), bump(nullptr), bump_end(nullptr), next_chunk_size(chunk_size > 0 ? chunk_size : 1)
+{
+}
+
+template <typename T>
+NodePool<T>::Arena::~Arena()
+{
+	// Every Node has already been destroyed by its owner, so only the raw chunks remain
+	for (typename std::vector<Slot *>::size_type i = 0; i < chunks.size(); i++)
+		delete[] chunks[i];
+}
+
+// Constructor for NodePool
+// Precondition:   chunk_size is greater than 0.
+// Postcondition:  A new, empty pool is created.
+template <typename T>
+NodePool<T>::NodePool(int chunk_size) : arena(std::make_shared<Arena>(chunk_size))
+{
+}
+
+// Return storage for one Node, preferring recycled slots, then the unused tail of the newest chunk
+template <typename T>
+void *NodePool<T>::allocate()
+{
+	Arena &a = *arena;
+	if (a.free_list != nullptr) // Reuse the most recently freed slot
+	{
+		Slot *slot = a.free_list;
+		a.free_list = slot->next_free;
+		return slot;
+	}
+	if (a.bump == a.bump_end) // Newest chunk is used up, so allocate the next one
+	{
+		Slot *chunk = new Slot[a.next_chunk_size];
+		a.chunks.push_back(chunk);
+		a.bump = chunk;
+		a.bump_end = chunk + a.next_chunk_size;
+		if (a.next_chunk_size < NODE_POOL_MAX_CHUNK)
+			a.next_chunk_size *= 2; // Grow geometrically up to the cap
+	}
+	return a.bump++; // Hand out slots in address order for locality
+}
+
+// Create a Node from the supplied constructor arguments
+// Precondition:   args are valid arguments for a constructor of Node<T>.
+// Postcondition:  A new Node is returned, with next and prev initialised.
+template <typename T>
+template <typename... Args>
+Node<T> *NodePool<T>::create(Args &&...args)
+{
+	void *slot = allocate();
+	try
+	{
+		Node<T> *node = new (slot) Node<T>(std::forward<Args>(args)...);
+		BROWSER_STAT(STAT_NODES_ALLOCATED, 1);
+		return node;
+	}
+	catch (...)
+	{
+		// Constructing the data failed, so give the slot back before propagating
+		static_cast<Slot *>(slot)->next_free = arena->free_list;
+		arena->free_list = static_cast<Slot *>(slot);
+		throw;
+	}
+}
+
+// Destroy a Node and return its slot to the free list
+// Precondition:   node was created by this pool (or a copy of it) and has not already been destroyed.
+// Postcondition:  The Node is destroyed and its slot is available to the next call to create.
+template <typename T>
+void NodePool<T>::destroy(Node<T> *node)
+{
+	node->~Node<T>();
+	BROWSER_STAT(STAT_NODES_FREED, 1);
+	Slot *slot = reinterpret_cast<Slot *>(node);
+	slot->next_free = arena->free_list;
+	arena->free_list = slot;
+}
+
+// Set aside storage for n more Nodes
+// Precondition:   None
+// Postcondition:  The next n calls to create are served from storage that already exists.
+template <typename T>
+void NodePool<T>::reserve(int n)
+{
+	Arena &a = *arena;
+	if (n <= a.bump_end - a.bump) // The newest chunk already has room
+		return;
+	while (a.bump != a.bump_end) // Keep the unused tail of the newest chunk on the free list
+	{
+		a.bump->next_free = a.free_list;
+		a.free_list = a.bump++;
+	}
+	Slot *chunk = new Slot[n]; // One chunk large enough for the whole request
+	a.chunks.push_back(chunk);
+	a.bump = chunk;
+	a.bump_end = chunk + n;
+}
+
+template <typename T>
+bool NodePool<T>::operator==(const NodePool<T> &other) const
+{
+	return arena == other.arena;
+}
+
+template <typename T>
+bool NodePool<T>::operator!=(const NodePool<T> &other) const
+{
+	return arena != other.arena;
+}
+
+// ---- HeapAllocator --------
+
+template <typename T>
+template <typename... Args>
+Node<T> *HeapAllocator<T>::create(Args &&...args)
+{
+	Node<T> *node = new Node<T>(std::forward<Args>(args)...);
+	BROWSER_STAT(STAT_NODES_ALLOCATED, 1);
+	return node;
+}
+
+template <typename T>
+void HeapAllocator<T>::destroy(Node<T> *node)
+{
+	delete node;
+	BROWSER_STAT(STAT_NODES_FREED, 1);
+}
+
+template <typename T>
+void HeapAllocator<T>::reserve(int)
+{
+}
+
+template <typename T>
+bool HeapAllocator<T>::operator==(const HeapAllocator<T> &) const
+{
+	return true;
+}
+
+template <typename T>
+bool HeapAllocator<T>::operator!=(const HeapAllocator<T> &) const
+{
+	return false;
+}
@@ -0,0 +1,100 @@
+/*
+ * output_buffer.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "output_buffer.h"
+
+#include <algorithm>
+
+// Create an empty buffer of capacity bytes in front of sink
+OutputBuffer::OutputBuffer(std::streambuf *sink, std::size_t capacity)
+		: sink(sink), block(capacity > 0 ? capacity : 1)
+{
+	setp(block.data(), block.data() + block.size());
+}
+
+// Write out whatever is still buffered
+OutputBuffer::~OutputBuffer()
+{
+	flush();
+}
+
+// Write the buffered bytes to the sink, without flushing it
+bool OutputBuffer::drain()
+{
+	std::streamsize pending = pptr() - pbase();
+	bool written = (pending == 0 || sink->sputn(pbase(), pending) == pending);
+	setp(block.data(), block.data() + block.size()); // Start filling from the front again
+	return written;
+}
+
+// Write everything buffered so far to the sink, and flush the sink
+bool OutputBuffer::flush()
+{
+	bool written = drain();
+	return sink->pubsync() == 0 && written;
+}
+
+// The block is full: pass it on, then buffer ch
+OutputBuffer::int_type OutputBuffer::overflow(int_type ch)
+{
+	if (!drain())
+		return traits_type::eof();
+	if (!traits_type::eq_int_type(ch, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+	}
+	return traits_type::not_eof(ch);
+}
+
+// Buffer n bytes, passing on the block each time it fills
+std::streamsize OutputBuffer::xsputn(const char *s, std::streamsize n)
+{
+	std::streamsize done = 0;
+	while (done < n)
+	{
+		if (pptr() == epptr() && !drain())
+			break;
+		std::streamsize room = std::min<std::streamsize>(epptr() - pptr(), n - done);
+		std::copy(s + done, s + done + room, pptr());
+		pbump(static_cast<int>(room));
+		done += room;
+	}
+	return done;
+}
+
+// Ignore flush requests from the stream; output is passed on only when the block fills or flush is called
+int OutputBuffer::sync()
+{
+	return 0;
+}
+
+// Create a buffer that has discarded nothing
+DiscardBuffer::DiscardBuffer()
+		: line_count(0)
+{
+}
+
+// Return the number of lines discarded so far
+long DiscardBuffer::lines() const
+{
+	return line_count;
+}
+
+// Discard one character
+DiscardBuffer::int_type DiscardBuffer::overflow(int_type ch)
+{
+	if (traits_type::eq_int_type(ch, traits_type::to_int_type('\n')))
+		line_count++;
+	return traits_type::not_eof(ch);
+}
+
+// Discard n characters
+std::streamsize DiscardBuffer::xsputn(const char *s, std::streamsize n)
+{
+	line_count += std::count(s, s + n, '\n');
+	return n;
+}
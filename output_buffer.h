@@ -0,0 +1,85 @@
+/*
+* output_buffer.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* Stream buffers used when replaying a command file.
+*
+* OutputBuffer collects everything written to it in one large block and passes it on to another stream buffer
+* only when the block fills up or flush is called. Flush requests from the stream (std::endl, std::flush) are
+* ignored, so a replay makes a handful of large writes instead of several small ones per command.
+*
+* DiscardBuffer drops everything written to it, counting the lines.
+*/
+
+#ifndef SENG1120_OUTPUT_BUFFER_H
+#define SENG1120_OUTPUT_BUFFER_H
+
+#include <cstddef>
+#include <streambuf>
+#include <vector>
+
+class OutputBuffer : public std::streambuf
+{
+public:
+    /**
+     * Precondition:  sink is a valid stream buffer that outlives this one.
+     * Postcondition: An empty buffer of capacity bytes is created in front of sink.
+     */
+    OutputBuffer(std::streambuf* sink, std::size_t capacity = 1 << 20);
+
+    /**
+     * Precondition:  None
+     * Postcondition: Anything still buffered has been written to the sink.
+     */
+    ~OutputBuffer();
+
+    /**
+     * Write everything buffered so far to the sink, and flush the sink.
+     *
+     * Precondition:  None
+     * Postcondition: The buffer is empty. true is returned if the sink accepted every byte.
+     */
+    bool flush();
+
+protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+    int sync() override;
+
+private:
+    OutputBuffer(const OutputBuffer&);              // Not copyable
+    OutputBuffer& operator=(const OutputBuffer&);
+
+    bool drain();                                   // Write the buffered bytes to the sink, without flushing it
+
+    std::streambuf* sink;                           // Where the output finally goes
+    std::vector<char> block;                        // The buffered bytes
+};
+
+class DiscardBuffer : public std::streambuf
+{
+public:
+    /**
+     * Precondition:  None
+     * Postcondition: A buffer that has discarded nothing is created.
+     */
+    DiscardBuffer();
+
+    /**
+     * Return the number of lines discarded so far.
+     *
+     * Precondition:  None
+     * Postcondition: None
+     */
+    long lines() const;
+
+protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+private:
+    long line_count;                                // Number of '\n' characters discarded
+};
+
+#endif
@@ -0,0 +1,264 @@
+/*
+ * prefix_index.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "prefix_index.h"
+
+#include <algorithm>
+
+// Marks a node that no string ends at
+static const std::uint32_t NO_ID = static_cast<std::uint32_t>(-1);
+
+// A subtree, or the string ending at one node, waiting to be expanded by complete
+struct PrefixEntry
+{
+	int bound;				// Score of the string, or the bound on the subtree
+	int node;
+	bool string;			// True for the string ending at node, false for its whole subtree
+	std::size_t start;		// Text of node, as a range of the texts built up by complete
+	std::size_t length;
+};
+
+// Orders entries so that the highest bound comes out first, then the alphabetically first text, then a string
+// before the subtree below it
+struct PrefixEntryOrder
+{
+	const std::string *texts;
+
+	bool operator()(const PrefixEntry &a, const PrefixEntry &b) const
+	{
+		if (a.bound != b.bound)
+			return a.bound < b.bound;
+		int order = std::string_view(*texts).substr(a.start, a.length).compare(std::string_view(*texts).substr(b.start, b.length));
+		if (order != 0)
+			return order > 0;
+		return !a.string && b.string;
+	}
+};
+
+// Constructor for PrefixIndex
+// Precondition:   None
+// Postcondition:  An empty index is created, holding only the root.
+PrefixIndex::PrefixIndex()
+		: count(0)
+{
+	new_node(std::string_view(), -1);
+}
+
+// Take a node from the free list, or add a new one
+int PrefixIndex::new_node(std::string_view label, int parent)
+{
+	int node;
+	if (free_nodes.empty())
+	{
+		node = static_cast<int>(nodes.size());
+		nodes.push_back(Node());
+	}
+	else
+	{
+		node = free_nodes.back();
+		free_nodes.pop_back();
+	}
+	Node &created = nodes[node];
+	created.label.assign(label.data(), label.size());
+	created.id = NO_ID;
+	created.score = 0;
+	created.best = 0;
+	created.parent = parent;
+	created.child = -1;
+	created.sibling = -1;
+	return node;
+}
+
+// Insert node among the children of parent, keeping them in order of their first character
+void PrefixIndex::link_child(int parent, int node)
+{
+	unsigned char first = static_cast<unsigned char>(nodes[node].label[0]);
+	int *link = &nodes[parent].child;
+	while (*link != -1 && static_cast<unsigned char>(nodes[*link].label[0]) < first)
+		link = &nodes[*link].sibling;
+	nodes[node].sibling = *link;
+	*link = node;
+	nodes[node].parent = parent;
+}
+
+// Remove node from the children of its parent
+void PrefixIndex::unlink_child(int node)
+{
+	int *link = &nodes[nodes[node].parent].child;
+	while (*link != node)
+		link = &nodes[*link].sibling;
+	*link = nodes[node].sibling;
+}
+
+// Fold the only child of a node that no string ends at into it, so the tree stays compressed
+void PrefixIndex::merge_child(int node)
+{
+	int child = nodes[node].child;
+	nodes[node].label += nodes[child].label;
+	nodes[node].id = nodes[child].id;
+	nodes[node].score = nodes[child].score;
+	nodes[node].best = nodes[child].best;
+	nodes[node].child = nodes[child].child;
+	for (int grandchild = nodes[node].child; grandchild != -1; grandchild = nodes[grandchild].sibling)
+		nodes[grandchild].parent = node;
+	if (nodes[node].id != NO_ID)
+		node_of[nodes[node].id] = node;
+	nodes[child].label.clear();
+	free_nodes.push_back(child);
+}
+
+// Raise the bounds from node up to the root until one already covers score
+void PrefixIndex::push_bound(int node, int score)
+{
+	for (; node != -1 && nodes[node].best < score; node = nodes[node].parent)
+		nodes[node].best = score;
+}
+
+// Add a string, splitting an edge if it ends or branches part way along one
+void PrefixIndex::add(std::uint32_t id, std::string_view text, int score)
+{
+	int node = 0;
+	std::size_t at = 0; // Characters of text matched so far
+	while (at < text.size())
+	{
+		unsigned char next = static_cast<unsigned char>(text[at]);
+		int child = nodes[node].child;
+		while (child != -1 && static_cast<unsigned char>(nodes[child].label[0]) < next)
+			child = nodes[child].sibling;
+		if (child == -1 || static_cast<unsigned char>(nodes[child].label[0]) != next) // No edge, so the rest is a new leaf
+		{
+			int leaf = new_node(text.substr(at), node);
+			link_child(node, leaf);
+			node = leaf;
+			break;
+		}
+
+		std::size_t common = 1; // Length shared by the edge and the rest of text
+		const std::string &label = nodes[child].label;
+		while (common < label.size() && at + common < text.size() && label[common] == text[at + common])
+			common++;
+		if (common < label.size()) // Split the edge, with a new node where they part
+		{
+			std::string upper = label.substr(0, common); // Copied, as new_node may move the nodes
+			int middle = new_node(upper, node);
+			nodes[middle].best = nodes[child].best;
+			unlink_child(child);
+			link_child(node, middle);
+			nodes[child].label.erase(0, common);
+			link_child(middle, child);
+			child = middle;
+		}
+		node = child;
+		at += common;
+	}
+
+	nodes[node].id = id;
+	nodes[node].score = score;
+	if (id >= node_of.size())
+		node_of.resize(id + 1, -1);
+	node_of[id] = node;
+	push_bound(node, score);
+	count++;
+}
+
+// Change the score of id; a lower score leaves the bounds above it for complete to correct
+void PrefixIndex::rescore(std::uint32_t id, int score)
+{
+	int node = node_of[id];
+	nodes[node].score = score;
+	push_bound(node, score);
+}
+
+// Remove id, freeing its node if it is a leaf and merging away any node left with one child and no string
+void PrefixIndex::erase(std::uint32_t id)
+{
+	int node = node_of[id];
+	node_of[id] = -1;
+	nodes[node].id = NO_ID;
+	nodes[node].score = 0;
+	count--;
+	if (node == 0) // The empty string, at the root
+		return;
+
+	if (nodes[node].child == -1)
+	{
+		int parent = nodes[node].parent;
+		unlink_child(node);
+		nodes[node].label.clear();
+		free_nodes.push_back(node);
+		node = parent;
+		if (node == 0 || nodes[node].id != NO_ID)
+			return;
+	}
+	if (nodes[node].child != -1 && nodes[nodes[node].child].sibling == -1)
+		merge_child(node);
+}
+
+// Find the k highest-scoring strings starting with prefix, expanding the best bound first
+void PrefixIndex::complete(std::string_view prefix, int k, std::vector<std::uint32_t> &found)
+{
+	found.clear();
+	if (k <= 0)
+		return;
+
+	int node = 0;
+	std::string texts; // Text of node, which may run past the end of prefix, then the text of every entry after it
+	while (texts.size() < prefix.size())
+	{
+		unsigned char next = static_cast<unsigned char>(prefix[texts.size()]);
+		int child = nodes[node].child;
+		while (child != -1 && static_cast<unsigned char>(nodes[child].label[0]) != next)
+			child = nodes[child].sibling;
+		if (child == -1)
+			return;
+		const std::string &label = nodes[child].label;
+		std::size_t compared = std::min(label.size(), prefix.size() - texts.size());
+		if (label.compare(0, compared, prefix.substr(texts.size(), compared)) != 0)
+			return;
+		texts += label;
+		node = child;
+	}
+
+	PrefixEntryOrder order = { &texts };
+	std::vector<PrefixEntry> waiting; // A heap, highest first
+	waiting.push_back(PrefixEntry{nodes[node].best, node, false, 0, texts.size()});
+	while (!waiting.empty() && static_cast<int>(found.size()) < k)
+	{
+		std::pop_heap(waiting.begin(), waiting.end(), order);
+		PrefixEntry entry = waiting.back();
+		waiting.pop_back();
+		if (entry.string)
+		{
+			found.push_back(nodes[entry.node].id);
+			continue;
+		}
+
+		Node &expanded = nodes[entry.node];
+		int bound = expanded.score; // Worked out afresh, to correct a bound left high by lower or erase
+		if (expanded.id != NO_ID)
+		{
+			waiting.push_back(PrefixEntry{expanded.score, entry.node, true, entry.start, entry.length});
+			std::push_heap(waiting.begin(), waiting.end(), order);
+		}
+		for (int child = expanded.child; child != -1; child = nodes[child].sibling)
+		{
+			if (nodes[child].best > bound)
+				bound = nodes[child].best;
+			std::size_t start = texts.size();
+			texts.append(texts, entry.start, entry.length);
+			texts += nodes[child].label;
+			waiting.push_back(PrefixEntry{nodes[child].best, child, false, start, texts.size() - start});
+			std::push_heap(waiting.begin(), waiting.end(), order);
+		}
+		expanded.best = bound;
+	}
+}
+
+// Return the number of strings in the index
+int PrefixIndex::size() const
+{
+	return count;
+}
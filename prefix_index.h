@@ -0,0 +1,93 @@
+/*
+* prefix_index.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a radix tree (a trie with runs of single children merged into one edge) over a set of
+* strings, each with an id and a score, which answers "the k highest-scoring strings starting with a prefix".
+* The UrlTable keeps one over every URL in the history or bookmarks, scored by its number of references, so the
+* browser can autocomplete what the user is typing.
+*
+* Every node records an upper bound on the scores in its subtree. A query walks down to the prefix and then
+* expands nodes best bound first, so it stops after about k leaves rather than visiting the whole subtree.
+* Raising a score pushes the bound up the path until an ancestor already covers it; lowering one leaves the
+* bounds above too high, which costs nothing then and is corrected by the next query that expands those nodes.
+* A string's node is found from its id in O(1), so changing its score does not walk the string.
+*/
+
+#ifndef SENG1120_PREFIX_INDEX_H
+#define SENG1120_PREFIX_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class PrefixIndex
+{
+public:
+    /**
+     * Precondition:  None
+     * Postcondition: An empty index is created.
+     */
+    PrefixIndex();
+
+    /**
+     * Precondition:  id is not in the index, no other id in the index has the same text, and score is above 0.
+     * Postcondition: text can be found by complete under id, with the supplied score.
+     */
+    void add(std::uint32_t id, std::string_view text, int score);
+
+    /**
+     * Precondition:  id is in the index and score is above 0.
+     * Postcondition: The score of id has been changed to score.
+     */
+    void rescore(std::uint32_t id, int score);
+
+    /**
+     * Precondition:  id is in the index.
+     * Postcondition: id is no longer in the index, and the nodes it needed have been freed or merged.
+     */
+    void erase(std::uint32_t id);
+
+    /**
+     * Find the ids of the k highest-scoring strings starting with prefix, highest first, with equal scores in
+     * alphabetical order.
+     *
+     * Precondition:  None
+     * Postcondition: Up to k ids have been stored in found, which was cleared first.
+     */
+    void complete(std::string_view prefix, int k, std::vector<std::uint32_t>& found);
+
+    /**
+     * Precondition:  None
+     * Postcondition: The number of strings in the index is returned.
+     */
+    int size() const;
+
+private:
+    // One node of the tree. The text of a node is the labels on the path from the root down to it.
+    struct Node
+    {
+        std::string label;      // Characters on the edge from the parent
+        std::uint32_t id;       // String ending at this node, or NO_ID
+        int score;              // Score of that string, 0 if there is none
+        int best;               // At least every score in the subtree
+        int parent;
+        int child;              // First child, or -1; siblings are kept in order of their labels
+        int sibling;            // Next sibling, or -1
+    };
+
+    int new_node(std::string_view label, int parent);   // Take a node from the free list, or a new one
+    void link_child(int parent, int node);              // Insert node among the children of parent, in order
+    void unlink_child(int node);                        // Remove node from the children of its parent
+    void merge_child(int node);                         // Fold the only child of an id-less node into it
+    void push_bound(int node, int score);               // Raise the bounds from node up to cover score
+
+    std::vector<Node> nodes;                            // Node 0 is the root, with an empty label
+    std::vector<int> free_nodes;                        // Nodes freed by erase, ready to be reused
+    std::vector<int> node_of;                           // Indexed by id: the node the string ends at, or -1
+    int count;                                          // Number of strings
+};
+
+#endif
@@ -0,0 +1,221 @@
+/*
+ * replay.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "replay.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "browser.h"
+#include "commands.h"
+#include "output_buffer.h"
+
+namespace
+{
+	// Sessions waiting to be replayed by one worker. The owner takes from the front and thieves from the back,
+	// so with sessions dealt out in order the owner works through them roughly in the order they are printed.
+	struct WorkQueue
+	{
+		std::mutex lock;
+		std::deque<long> sessions;
+	};
+
+	// What one session printed, waiting to be written out in order
+	struct SessionOutput
+	{
+		std::string out;
+		std::string err;
+		std::string final_site;
+		long commands;
+		long errors;
+		bool ready;
+	};
+
+	// State shared by the workers and the thread writing the output
+	struct ReplayState
+	{
+		std::vector<WorkQueue> queues;
+		std::vector<SessionOutput> outputs;
+		std::mutex done_lock;
+		std::condition_variable done;
+
+		ReplayState(int workers, long sessions) : queues(workers), outputs(sessions) {}
+
+		// Take the next session for worker, from its own queue or else from another's
+		bool take(int worker, long &session)
+		{
+			int workers = static_cast<int>(queues.size());
+			for (int i = 0; i < workers; i++)
+			{
+				WorkQueue &queue = queues[(worker + i) % workers];
+				std::lock_guard<std::mutex> guard(queue.lock);
+				if (queue.sessions.empty())
+					continue;
+				if (i == 0) // Own queue
+				{
+					session = queue.sessions.front();
+					queue.sessions.pop_front();
+				}
+				else // Steal the session that will be printed last
+				{
+					session = queue.sessions.back();
+					queue.sessions.pop_back();
+				}
+				return true;
+			}
+			return false; // Nothing is ever added once replay starts, so every queue is finished
+		}
+	};
+}
+
+// Split a trace into sessions, in order of first appearance
+SessionReplay::SessionReplay(std::string_view trace)
+		: commands(0)
+{
+	std::unordered_map<std::string_view, long> index; // Session id to position in sessions
+	std::size_t start = 0;
+	while (start < trace.size())
+	{
+		std::size_t end = trace.find('\n', start);
+		if (end == std::string_view::npos)
+			end = trace.size();
+		std::string_view line = trace.substr(start, end - start);
+		start = end + 1;
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		if (line.empty())
+			continue;
+
+		std::size_t space = line.find(' ');
+		std::string_view id = line.substr(0, space);
+		std::string_view command = (space == std::string_view::npos ? std::string_view() : line.substr(space + 1));
+
+		std::unordered_map<std::string_view, long>::iterator entry = index.find(id);
+		if (entry == index.end()) // First command of a new session
+		{
+			entry = index.insert(std::make_pair(id, static_cast<long>(sessions.size()))).first;
+			sessions.push_back(Session());
+			sessions.back().id = id;
+		}
+		sessions[entry->second].commands.push_back(command);
+		commands++;
+	}
+}
+
+// Return the number of sessions
+long SessionReplay::session_count() const
+{
+	return static_cast<long>(sessions.size());
+}
+
+// Return the number of commands
+long SessionReplay::command_count() const
+{
+	return commands;
+}
+
+// Replay every session on a pool of worker threads and write the output in session order
+ReplayTotals SessionReplay::run(int threads, std::ostream &out, std::ostream &err, bool summary) const
+{
+	long count = session_count();
+	int workers = (threads < 1 ? 1 : threads);
+	if (count > 0 && workers > count) // No use for more workers than sessions
+		workers = static_cast<int>(count);
+
+	ReplayState state(workers, count);
+	for (long i = 0; i < count; i++) // Deal the sessions out in order
+		state.queues[i % workers].sessions.push_back(i);
+
+	std::vector<std::thread> pool;
+	for (int w = 0; w < workers; w++)
+	{
+		pool.push_back(std::thread([this, &state, w, summary]()
+		{
+			std::ostringstream session_out;
+			std::ostringstream session_err;
+			DiscardBuffer discard_out;
+			DiscardBuffer discard_err;
+			std::ostream null_out(&discard_out);
+			std::ostream null_err(&discard_err);
+			std::ostream &to_out = summary ? null_out : session_out;
+			std::ostream &to_err = summary ? null_err : session_err;
+
+			long session;
+			while (state.take(w, session))
+			{
+				const Session &current = sessions[session];
+				SessionOutput &result = state.outputs[session];
+				long errors_before = discard_err.lines();
+				long executed = 0;
+				{
+					Browser browser(to_out);
+					for (std::size_t i = 0; i < current.commands.size(); i++)
+					{
+						executed++;
+						if (!replay_command(browser, current.commands[i], to_out, to_err))
+							break;
+					}
+					result.final_site = browser.get_current_site();
+				}
+				result.commands = executed;
+				if (summary)
+					result.errors = discard_err.lines() - errors_before;
+				else
+				{
+					result.out = session_out.str();
+					result.err = session_err.str();
+					session_out.str(std::string());
+					session_err.str(std::string());
+					result.errors = 0;
+					for (std::size_t i = 0; i < result.err.size(); i++) // One line per error message
+						result.errors += (result.err[i] == '\n');
+				}
+
+				std::lock_guard<std::mutex> guard(state.done_lock);
+				result.ready = true;
+				state.done.notify_one();
+			}
+		}));
+	}
+
+	ReplayTotals totals = { count, 0, 0 };
+	for (long i = 0; i < count; i++) // Write each session once it is ready, in order
+	{
+		SessionOutput &result = state.outputs[i];
+		{
+			std::unique_lock<std::mutex> guard(state.done_lock);
+			state.done.wait(guard, [&result]() { return result.ready; });
+		}
+		const std::string_view id = sessions[i].id;
+		if (summary)
+			out << "Session " << id << ": " << result.final_site << '\n';
+		else
+		{
+			out << "Session " << id << ":\n" << result.out << "Current site: " << result.final_site << "\n\n";
+			std::size_t start = 0;
+			while (start < result.err.size()) // Label each error with its session
+			{
+				std::size_t end = result.err.find('\n', start);
+				end = (end == std::string::npos ? result.err.size() : end + 1);
+				err << '[' << id << "] " << std::string_view(result.err).substr(start, end - start);
+				start = end;
+			}
+		}
+		totals.commands += result.commands;
+		totals.errors += result.errors;
+		std::string().swap(result.out); // Written, so free it
+		std::string().swap(result.err);
+	}
+
+	for (std::size_t w = 0; w < pool.size(); w++)
+		pool[w].join();
+	return totals;
+}
@@ -0,0 +1,76 @@
+/*
+* replay.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class replays a trace that interleaves many independent browser sessions. Each line of the trace has
+* the form <session id> <command>, where the command is one the browser driver understands.
+*
+* Sessions are spread over a pool of worker threads. Each worker runs whole sessions, one Browser at a time,
+* taking sessions from its own queue and stealing from the other queues once its own is empty. Output is
+* collected per session and written in the order each session first appears in the trace, so the result does
+* not depend on the number of threads or on how the work was shared out.
+*/
+
+#ifndef SENG1120_REPLAY_H
+#define SENG1120_REPLAY_H
+
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+struct ReplayTotals
+{
+    long sessions;                      // Number of sessions replayed
+    long commands;                      // Number of commands executed, not counting any after a quit
+    long errors;                        // Number of error messages reported
+};
+
+class SessionReplay
+{
+public:
+    /**
+     * Split a trace into sessions. A trailing '\r' is removed from each line and empty lines are skipped.
+     * The trace is not copied, so it must outlive the replay.
+     *
+     * Precondition:  None
+     * Postcondition: Every command in the trace belongs to the session named at the start of its line.
+     */
+    SessionReplay(std::string_view trace);
+
+    /**
+     * Precondition:  None
+     * Postcondition: The number of distinct sessions in the trace is returned.
+     */
+    long session_count() const;
+
+    /**
+     * Precondition:  None
+     * Postcondition: The number of commands in the trace is returned.
+     */
+    long command_count() const;
+
+    /**
+     * Replay every session on the given number of worker threads, each session in a Browser of its own.
+     * For each session in order of first appearance, out receives a "Session <id>:" line followed by exactly
+     * what file mode prints for that session's commands, then a blank line. With summary set it receives a
+     * single "Session <id>: <final site>" line instead. Error messages go to err, each prefixed with
+     * "[<id>] ", unless summary is set, in which case they are only counted.
+     *
+     * Precondition:  threads > 0
+     * Postcondition: Every session has been replayed and the totals are returned.
+     */
+    ReplayTotals run(int threads, std::ostream& out, std::ostream& err, bool summary) const;
+
+private:
+    struct Session
+    {
+        std::string_view id;                        // The session id, as it appears in the trace
+        std::vector<std::string_view> commands;     // The session's commands, in trace order
+    };
+
+    std::vector<Session> sessions;                  // In order of first appearance
+    long commands;                                  // Total number of commands
+};
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * replay_bench.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ *
+ * Measures how session replay scales with the number of worker threads. A synthetic trace of interleaved
+ * sessions is built in memory and replayed with 1, 2, 4, ... up to the maximum number of threads, with the
+ * output discarded. The speedup is relative to one thread.
+ *
+ * Usage: ReplayBench [max threads] [sessions] [commands per session]
+ *        (defaults: one thread per core, 2000 sessions, 200 commands per session)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "output_buffer.h"
+#include "replay.h"
+
+// Build a trace of sessions * commands lines, with the sessions interleaved at random
+static std::string make_trace(int sessions, int commands)
+{
+	std::mt19937 random(1120);
+	std::vector<int> remaining(sessions, commands);
+	std::vector<int> open; // Sessions with commands left
+	for (int i = 0; i < sessions; i++)
+		open.push_back(i);
+
+	std::string trace;
+	while (!open.empty())
+	{
+		int pick = static_cast<int>(random() % open.size());
+		int session = open[pick];
+		trace += 's' + std::to_string(session) + ' ';
+		int kind = static_cast<int>(random() % 10);
+		if (kind < 6)
+			trace += "v www.site" + std::to_string(random() % 50) + ".com";
+		else if (kind == 6)
+			trace += "< " + std::to_string(random() % 4);
+		else if (kind == 7)
+			trace += "> " + std::to_string(random() % 4);
+		else if (kind == 8)
+			trace += "b";
+		else
+			trace += "r www.site" + std::to_string(random() % 50) + ".com";
+		trace += "\r\n";
+		if (--remaining[session] == 0)
+		{
+			open[pick] = open.back();
+			open.pop_back();
+		}
+	}
+	return trace;
+}
+
+int main(int argc, char *argv[])
+{
+	int cores = static_cast<int>(std::thread::hardware_concurrency());
+	int max_threads = (argc > 1 ? std::atoi(argv[1]) : (cores > 0 ? cores : 1));
+	int sessions = (argc > 2 ? std::atoi(argv[2]) : 2000);
+	int commands = (argc > 3 ? std::atoi(argv[3]) : 200);
+	if (max_threads < 1 || sessions < 1 || commands < 1)
+	{
+		std::fprintf(stderr, "Usage: %s [max threads] [sessions] [commands per session]\n", argv[0]);
+		return 1;
+	}
+
+	std::string trace = make_trace(sessions, commands);
+	SessionReplay replay(trace);
+	DiscardBuffer discard_out;
+	DiscardBuffer discard_err;
+	std::ostream out(&discard_out);
+	std::ostream err(&discard_err);
+
+	std::printf("%d sessions, %ld commands, %u cores\n", sessions, replay.command_count(), cores);
+	std::printf("%8s %10s %14s %8s\n", "threads", "seconds", "commands/s", "speedup");
+	double single = 0;
+	for (int threads = 1; threads <= max_threads; threads = (threads * 2 > max_threads && threads < max_threads ? max_threads : threads * 2))
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		replay.run(threads, out, err, false);
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if (threads == 1)
+			single = seconds;
+		std::printf("%8d %10.3f %14.0f %8.2f\n", threads, seconds, replay.command_count() / seconds, single / seconds);
+	}
+	return 0;
+}
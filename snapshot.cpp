@@ -0,0 +1,351 @@
+/*
+ * snapshot.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "snapshot.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "binary_io.h"
+
+// Magic bytes at the start of every snapshot
+static const char SNAPSHOT_MAGIC[4] = {'B', 'R', 'W', 'S'};
+
+// Size of the magic, version and payload length
+static const std::size_t SNAPSHOT_HEADER = 16;
+
+// Marks a snapshot URL that has not been interned yet
+static const url_id NOT_INTERNED = static_cast<url_id>(-1);
+
+// A URL read from a snapshot, and its id once interned
+struct SnapshotUrl
+{
+	std::string_view text; // Points into the snapshot
+	url_id id;
+};
+
+// A list of URL numbers in a snapshot, checked when first read and read again from entries to build it
+struct SnapshotList
+{
+	const char *entries; // Points into the snapshot
+	std::uint32_t count;
+};
+
+// A tab read from a snapshot
+struct SnapshotTab
+{
+	std::int32_t position;				// Index into the whole history of the tab, or -1 if it is empty
+	std::vector<std::uint32_t> pieces;	// The run, then the start, of each piece it shares
+	SnapshotList entries;				// The entries of its own
+};
+
+// Read a count and that many URL numbers, checking that each refers to one of the urls
+static SnapshotList read_list(ByteReader &in, std::uint32_t url_count, const char *missing)
+{
+	SnapshotList list;
+	list.count = in.count();
+	list.entries = in.position();
+	for (std::uint32_t i = 0; i < list.count; i++)
+	{
+		if (in.u32() >= url_count)
+			throw std::runtime_error(missing);
+	}
+	return list;
+}
+
+// Write a snapshot of browser to path, by way of a temporary file
+void BrowserSnapshot::save(const Browser &browser, const std::string &path, std::uint64_t generation)
+{
+	std::string data;
+	encode(browser, data, generation);
+
+	std::string temporary = path + ".tmp";
+	std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+	file.write(data.data(), static_cast<std::streamsize>(data.size()));
+	file.close();
+	if (!file)
+	{
+		std::remove(temporary.c_str());
+		throw std::runtime_error("Cannot write snapshot " + temporary);
+	}
+	if (std::rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		int error = errno;
+		std::remove(temporary.c_str());
+		throw std::runtime_error("Cannot replace snapshot " + path + ": " + std::strerror(error));
+	}
+}
+
+// Return the number of a URL in order of first use, numbering it if it is new
+static std::uint32_t number_url(std::unordered_map<url_id, std::uint32_t> &numbers, std::vector<url_id> &order, url_id id)
+{
+	std::pair<std::unordered_map<url_id, std::uint32_t>::iterator, bool> added =
+			numbers.insert(std::make_pair(id, static_cast<std::uint32_t>(order.size())));
+	if (added.second)
+		order.push_back(id);
+	return added.first->second;
+}
+
+
+// Append a snapshot of browser to data
+void BrowserSnapshot::encode(const Browser &browser, std::string &data, std::uint64_t generation)
+{
+	// Number the runs the tabs share in order of first use
+	std::unordered_map<const Browser::SharedRun *, std::uint32_t> run_numbers;
+	std::vector<const Browser::SharedRun *> runs;
+	for (const Browser::Tab &tab : browser.tabs)
+	{
+		for (const Browser::SharedPiece &piece : tab.shared)
+		{
+			if (run_numbers.insert(std::make_pair(piece.run, static_cast<std::uint32_t>(runs.size()))).second)
+				runs.push_back(piece.run);
+		}
+	}
+
+	// Write the lists, numbering the URLs in order of first use so only those still referred to are written
+	std::unordered_map<url_id, std::uint32_t> numbers;
+	std::vector<url_id> order;
+	std::string lists; // Everything after the URLs
+	put_u32(lists, static_cast<std::uint32_t>(runs.size()));
+	for (const Browser::SharedRun *run : runs) // Only the entries some tab still has, so each run starts at 0
+	{
+		put_u32(lists, static_cast<std::uint32_t>(run->entries->size() - run->live));
+		for (HistoryList::const_iterator entry = run->first_live; entry != run->entries->items().end(); ++entry)
+			put_u32(lists, number_url(numbers, order, *entry));
+	}
+	put_u32(lists, static_cast<std::uint32_t>(browser.tabs.size()));
+	put_u32(lists, static_cast<std::uint32_t>(browser.active));
+	for (const Browser::Tab &tab : browser.tabs)
+	{
+		int position = tab.shared_count + (tab.history->empty() ? -1 : tab.history->position());
+		if (tab.piece < tab.shared.size()) // Current is in a piece, after every entry of the pieces before it
+		{
+			position = tab.offset - tab.shared[tab.piece].start;
+			for (std::size_t i = 0; i < tab.piece; i++)
+				position += tab.shared[i].run->entries->size() - tab.shared[i].start;
+		}
+		put_u32(lists, static_cast<std::uint32_t>(position));
+		put_u32(lists, static_cast<std::uint32_t>(tab.shared.size()));
+		for (const Browser::SharedPiece &piece : tab.shared)
+		{
+			put_u32(lists, run_numbers[piece.run]);
+			put_u32(lists, static_cast<std::uint32_t>(piece.start - piece.run->live));
+		}
+		put_u32(lists, static_cast<std::uint32_t>(tab.history->size()));
+		for (url_id id : tab.history->items())
+			put_u32(lists, number_url(numbers, order, id));
+	}
+	put_u32(lists, static_cast<std::uint32_t>(browser.bookmarks->size()));
+	for (url_id id : browser.bookmarks->items())
+		put_u32(lists, number_url(numbers, order, id));
+
+	std::size_t start = data.size();
+	data.append(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+	put_u32(data, SNAPSHOT_VERSION);
+	put_u64(data, 0); // Payload length, filled in at the end
+	put_u64(data, generation);
+	put_u32(data, static_cast<std::uint32_t>(browser.history_limit));
+	put_string(data, browser.homepage);
+	put_u32(data, static_cast<std::uint32_t>(order.size()));
+	for (std::size_t i = 0; i < order.size(); i++)
+		put_string(data, browser.urls.lookup(order[i]));
+	data += lists;
+
+	std::string length;
+	put_u64(length, data.size() - start - SNAPSHOT_HEADER);
+	data.replace(start + 8, 8, length);
+}
+
+// Replace the state of browser with the snapshot in a file
+std::uint64_t BrowserSnapshot::load(Browser &browser, const std::string &path)
+{
+	MappedFile file(path);
+	return decode(browser, file.data, file.size);
+}
+
+
+// Replace the state of browser with the snapshot in data, checking all of it before changing anything
+std::uint64_t BrowserSnapshot::decode(Browser &browser, const char *data, std::size_t size)
+{
+	if (size < SNAPSHOT_HEADER || std::memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+		throw std::runtime_error("Not a browser snapshot.");
+	ByteReader in(data + sizeof(SNAPSHOT_MAGIC), size - sizeof(SNAPSHOT_MAGIC), "Snapshot");
+	std::uint32_t version = in.u32();
+	if (version < 1 || version > SNAPSHOT_VERSION) // Versions 1 and 2 hold one tab, and version 1 no generation
+		throw std::runtime_error("Unsupported snapshot version " + std::to_string(version) + ".");
+	if (in.u64() != in.remaining())
+		throw std::runtime_error("Snapshot length does not match its size.");
+	std::uint64_t generation = (version == 1 ? 0 : in.u64());
+
+	std::uint32_t history_limit = in.u32();
+	std::int32_t position = (version < 3 ? static_cast<std::int32_t>(in.u32()) : -1);
+	std::string_view homepage = in.string();
+	if (history_limit < 1 || history_limit > 0x7fffffff)
+		throw std::runtime_error("Snapshot has an invalid history limit.");
+
+	std::uint32_t url_count = in.count(); // Every string takes at least 4 bytes
+	std::vector<SnapshotUrl> urls(url_count);
+	for (std::uint32_t i = 0; i < url_count; i++)
+	{
+		urls[i].text = in.string();
+		urls[i].id = NOT_INTERNED;
+	}
+
+	std::vector<SnapshotList> runs;
+	std::vector<SnapshotTab> tabs;
+	std::uint32_t active = 0;
+	if (version < 3) // The history of a single tab
+	{
+		tabs.resize(1);
+		tabs[0].position = position;
+		tabs[0].entries = read_list(in, url_count, "Snapshot history refers to a missing URL.");
+	}
+	else
+	{
+		runs.resize(in.count()); // Every run takes at least 4 bytes
+		for (std::size_t i = 0; i < runs.size(); i++)
+		{
+			runs[i] = read_list(in, url_count, "Snapshot history refers to a missing URL.");
+			if (runs[i].count == 0)
+				throw std::runtime_error("Snapshot has an empty shared run.");
+		}
+		tabs.resize(in.count()); // Every tab takes at least 4 bytes
+		active = in.u32();
+		if (active >= tabs.size())
+			throw std::runtime_error("Snapshot has an invalid current tab.");
+		std::vector<std::uint32_t> earliest(runs.size(), static_cast<std::uint32_t>(-1)); // Earliest start in each run
+		for (std::size_t i = 0; i < tabs.size(); i++)
+		{
+			tabs[i].position = static_cast<std::int32_t>(in.u32());
+			tabs[i].pieces.resize(2 * static_cast<std::size_t>(in.count())); // Every piece takes 8 bytes
+			for (std::size_t j = 0; j < tabs[i].pieces.size(); j += 2)
+			{
+				std::uint32_t run = tabs[i].pieces[j] = in.u32();
+				std::uint32_t start = tabs[i].pieces[j + 1] = in.u32();
+				if (run >= runs.size() || start >= runs[run].count)
+					throw std::runtime_error("Snapshot has a tab sharing a missing run.");
+				earliest[run] = std::min(earliest[run], start);
+			}
+			tabs[i].entries = read_list(in, url_count, "Snapshot history refers to a missing URL.");
+		}
+		for (std::size_t i = 0; i < runs.size(); i++)
+		{
+			if (earliest[i] != 0) // Entries no tab has are never written
+				throw std::runtime_error("Snapshot has shared history that no tab has.");
+		}
+	}
+	for (std::size_t i = 0; i < tabs.size(); i++)
+	{
+		std::uint64_t history_count = tabs[i].entries.count;
+		for (std::size_t j = 0; j < tabs[i].pieces.size(); j += 2)
+			history_count += runs[tabs[i].pieces[j]].count - tabs[i].pieces[j + 1];
+		if (history_count > history_limit)
+			throw std::runtime_error("Snapshot history is longer than its limit.");
+		std::int32_t at = tabs[i].position;
+		if (history_count == 0 ? at != -1 : (at < 0 || static_cast<std::uint64_t>(at) >= history_count))
+			throw std::runtime_error("Snapshot has an invalid current position.");
+	}
+
+	SnapshotList bookmark_list = read_list(in, url_count, "Snapshot bookmarks refer to a missing URL.");
+	if (in.remaining() != 0)
+		throw std::runtime_error("Snapshot has data after its bookmarks.");
+
+	// The snapshot is valid, so release everything the browser refers to
+	BookmarkList &bookmarks = *browser.bookmarks;
+	for (Browser::Tab &tab : browser.tabs)
+	{
+		for (url_id id : tab.history->items())
+			browser.urls.release(id);
+		delete tab.history;
+		for (const Browser::SharedPiece &piece : tab.shared)
+			browser.leave_run(piece.run, piece.start, -1);
+	}
+	browser.tabs.clear();
+	browser.ranking.clear();
+	for (url_id id : bookmarks.items())
+		browser.urls.release(id);
+	bookmarks.clear();
+	browser.bookmarked.clear();
+	browser.history_limit = static_cast<int>(history_limit);
+	browser.homepage.assign(homepage.data(), homepage.size());
+
+	// Then rebuild the lists, interning each URL the first time it is used
+	browser.urls.reserve(static_cast<int>(url_count));
+	auto intern = [&](std::uint32_t entry)
+	{
+		SnapshotUrl &url = urls[entry];
+		if (url.id == NOT_INTERNED)
+			url.id = browser.urls.intern(url.text);
+		return url.id;
+	};
+	auto fill = [&](HistoryList &history, const SnapshotList &list)
+	{
+		ByteReader entries(list.entries, 4 * static_cast<std::size_t>(list.count));
+		history.reserve(static_cast<int>(list.count)); // One allocation for every history node
+		for (std::uint32_t i = 0; i < list.count; i++)
+		{
+			url_id id = intern(entries.u32());
+			browser.urls.retain(id);
+			history.push_back(id);
+			browser.ranking.visited(id);
+		}
+	};
+	std::vector<Browser::SharedRun *> shared(runs.size());
+	for (std::size_t i = 0; i < runs.size(); i++)
+	{
+		shared[i] = new Browser::SharedRun;
+		shared[i]->entries = new HistoryList();
+		fill(*shared[i]->entries, runs[i]);
+		shared[i]->live = 0;
+		shared[i]->first_live = shared[i]->entries->items().begin();
+	}
+	for (std::size_t i = 0; i < tabs.size(); i++)
+	{
+		Browser::Tab tab = { std::vector<Browser::SharedPiece>(), 0, new HistoryList(), 0, HistoryList::const_iterator(), 0 };
+		for (std::size_t j = 0; j < tabs[i].pieces.size(); j += 2)
+		{
+			Browser::SharedPiece piece = { shared[tabs[i].pieces[j]], static_cast<int>(tabs[i].pieces[j + 1]), HistoryList::const_iterator() };
+			piece.first = piece.run->first_live;
+			for (int k = 0; k < piece.start; k++)
+				++piece.first;
+			piece.run->starts.push_back(piece.start);
+			tab.shared.push_back(piece);
+			tab.shared_count += piece.run->entries->size() - piece.start;
+		}
+		fill(*tab.history, tabs[i].entries);
+		browser.tabs.push_back(tab);
+
+		browser.active = i; // Put current in place from the newest entry, as the tab's own list may be empty
+		browser.history = tab.history;
+		browser.to_newest();
+		if (tabs[i].position >= 0)
+			browser.move_current(tabs[i].position - browser.count_history() + 1);
+	}
+	browser.active = active;
+	browser.history = browser.tabs[active].history;
+
+	bookmarks.reserve(static_cast<int>(bookmark_list.count));
+	ByteReader bookmark_entries(bookmark_list.entries, 4 * static_cast<std::size_t>(bookmark_list.count));
+	for (std::uint32_t i = 0; i < bookmark_list.count; i++)
+	{
+		url_id id = intern(bookmark_entries.u32());
+		if (browser.is_bookmarked(id)) // A URL bookmarked twice is kept once, as bookmark_current would
+			continue;
+		browser.urls.retain(id);
+		bookmarks.push_back(id);
+		if (id >= browser.bookmarked.size())
+			browser.bookmarked.resize(id + 1, false);
+		browser.bookmarked[id] = true;
+	}
+	return generation;
+}
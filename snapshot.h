@@ -0,0 +1,91 @@
+/*
+* snapshot.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* Saves the full state of a Browser to a compact binary file and restores it, so a browser can be brought back
+* without replaying the commands that built it. The state is every tab's history in order with its current
+* position, the current tab, the history limit, the homepage and the bookmarks in order. History that tabs share
+* (see Browser::duplicate_tab) is written once, and is shared again once loaded.
+*
+* The file is little-endian and laid out as follows, with every string stored as a u32 length and its bytes:
+*
+*     "BRWS"                  magic
+*     u32 version             SNAPSHOT_VERSION; versions above SNAPSHOT_VERSION are rejected
+*     u64 payload length      number of bytes after this field, checked against the file size
+*     u64 generation          first journal segment not folded into the snapshot (see journal.h); absent in
+*                             version 1, which is still read, as generation 0
+*     u32 history limit
+*     string homepage
+*     u32 url count, then that many strings
+*     u32 run count, then for each shared run:
+*         u32 entry count, then that many u32 indexes into the urls
+*     u32 tab count, then u32 current tab
+*     for each tab:
+*         i32 current position    index into the whole history of the tab, or -1 if it is empty
+*         u32 piece count, then for each run the tab shares, oldest first, u32 run and u32 first entry it has
+*         u32 entry count, then that many u32 indexes into the urls, for the newer entries of its own
+*     u32 bookmark count, then that many u32 indexes into the urls
+*
+* Versions 1 and 2, which are still read, hold a single tab: the current position comes after the history
+* limit, and the history is a u32 count and indexes in place of the runs and tabs.
+*
+* Loading maps the file into memory and reads it in place, interning each URL straight from the mapping, and
+* sets aside room for the whole history in one go before filling it. A URL bookmarked more than once is kept
+* once.
+*/
+
+#ifndef SENG1120_SNAPSHOT_H
+#define SENG1120_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "browser.h"
+
+// Version written by save; bump it whenever the layout changes
+const std::uint32_t SNAPSHOT_VERSION = 3;
+
+class BrowserSnapshot
+{
+public:
+    /**
+     * Write the state of browser to a file, recording the journal generation it is current up to. The
+     * snapshot is written to path + ".tmp" and renamed over path, so an existing snapshot is never left half
+     * written. Throws std::runtime_error if it cannot be written.
+     *
+     * Precondition:  None
+     * Postcondition: path holds a snapshot of browser. The browser is unchanged.
+     */
+    static void save(const Browser& browser, const std::string& path, std::uint64_t generation = 0);
+
+    /**
+     * Append the snapshot of browser to data, as save would write it.
+     *
+     * Precondition:  None
+     * Postcondition: data ends with a snapshot of browser. The browser is unchanged.
+     */
+    static void encode(const Browser& browser, std::string& data, std::uint64_t generation = 0);
+
+    /**
+     * Replace the state of browser with the snapshot in a file, which is mapped into memory rather than read.
+     * Throws std::runtime_error if the file cannot be read or is not a valid snapshot of a known version.
+     *
+     * Precondition:  None
+     * Postcondition: browser is in the state that was saved and its generation is returned. If the snapshot
+     *                is rejected, browser is unchanged.
+     */
+    static std::uint64_t load(Browser& browser, const std::string& path);
+
+    /**
+     * Replace the state of browser with the snapshot in data, as load does for a file.
+     *
+     * Precondition:  data points to size readable bytes.
+     * Postcondition: browser is in the state that was saved and its generation is returned. If the snapshot
+     *                is rejected, browser is unchanged.
+     */
+    static std::uint64_t decode(Browser& browser, const char* data, std::size_t size);
+};
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * stats.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "stats.h"
+
+#include <cstdio>
+#include <cstring>
+
+const char BrowserStats::COMMANDS[] = "v<>rRatbcpHBVndxwTSq?";
+
+BrowserStats::CommandTimes BrowserStats::times[BrowserStats::COMMAND_SLOTS];
+
+// Start or stop collecting statistics
+void BrowserStats::enable(bool on)
+{
+#ifdef BROWSER_STATS
+	active.store(on);
+#else
+	(void)on; // Nothing is recorded when compiled out, so stay off
+#endif
+}
+
+// Return the row for a command code, with every unknown code sharing the last row
+int BrowserStats::slot_of(char command)
+{
+	const char *found = (command == '\0' ? nullptr : std::strchr(COMMANDS, command));
+	return (found == nullptr ? COMMAND_SLOTS - 1 : static_cast<int>(found - COMMANDS));
+}
+
+// Return the histogram bucket for a time: exact below 16ns, then 16 buckets for each power of two
+int BrowserStats::bucket_of(std::uint64_t nanoseconds)
+{
+	if (nanoseconds < static_cast<std::uint64_t>(SUB_BUCKETS))
+		return static_cast<int>(nanoseconds);
+	int top_bit = 63 - __builtin_clzll(nanoseconds);
+	int shift = top_bit - SUB_BUCKET_BITS;
+	return (shift + 1) * SUB_BUCKETS + static_cast<int>((nanoseconds >> shift) & (SUB_BUCKETS - 1));
+}
+
+// Return the largest time that falls in a bucket
+std::uint64_t BrowserStats::bucket_top(int bucket)
+{
+	if (bucket < SUB_BUCKETS)
+		return static_cast<std::uint64_t>(bucket);
+	int shift = bucket / SUB_BUCKETS - 1;
+	std::uint64_t bottom = static_cast<std::uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+	return bottom + ((std::uint64_t(1) << shift) - 1);
+}
+
+// Record one run of a command
+void BrowserStats::record(char command, std::uint64_t nanoseconds)
+{
+	CommandTimes &row = times[slot_of(command)];
+	row.count.fetch_add(1, std::memory_order_relaxed);
+	row.total.fetch_add(nanoseconds, std::memory_order_relaxed);
+	row.histogram[bucket_of(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+	std::uint64_t slowest = row.max.load(std::memory_order_relaxed);
+	while (nanoseconds > slowest && !row.max.compare_exchange_weak(slowest, nanoseconds, std::memory_order_relaxed))
+	{
+	}
+}
+
+// Return the time below which the given fraction of runs fall, to the accuracy of the histogram
+std::uint64_t BrowserStats::percentile(const CommandTimes &row, double fraction)
+{
+	std::uint64_t count = row.count.load(std::memory_order_relaxed);
+	std::uint64_t rank = static_cast<std::uint64_t>(fraction * static_cast<double>(count) + 0.999999); // Runs at or below
+	if (rank == 0)
+		rank = 1;
+	std::uint64_t seen = 0;
+	for (int bucket = 0; bucket < BUCKETS; bucket++)
+	{
+		seen += row.histogram[bucket].load(std::memory_order_relaxed);
+		if (seen >= rank)
+		{
+			std::uint64_t top = bucket_top(bucket);
+			std::uint64_t slowest = row.max.load(std::memory_order_relaxed);
+			return (top < slowest ? top : slowest); // The bucket may reach past the slowest run
+		}
+	}
+	return row.max.load(std::memory_order_relaxed); // Runs recorded while counting
+}
+
+// Print the statistics collected so far
+void BrowserStats::print(std::ostream &out)
+{
+#ifndef BROWSER_STATS
+	out << "Statistics are not compiled in; build with make DEFINES=-DBROWSER_STATS." << std::endl;
+#else
+	if (!enabled())
+	{
+		out << "Statistics are not being collected; run with --stats." << std::endl;
+		return;
+	}
+
+	char line[160];
+	out << "Command statistics (times in nanoseconds):" << std::endl;
+	std::snprintf(line, sizeof(line), "%-8s %12s %12s %10s %10s %10s %10s %10s",
+								"command", "count", "total_ms", "mean", "p50", "p99", "p99.9", "max");
+	out << line << std::endl;
+	for (int slot = 0; slot < COMMAND_SLOTS; slot++)
+	{
+		const CommandTimes &row = times[slot];
+		std::uint64_t count = row.count.load(std::memory_order_relaxed);
+		if (count == 0) // Only show commands that have been run
+			continue;
+		std::uint64_t total = row.total.load(std::memory_order_relaxed);
+		char name[8] = "other";
+		if (slot < COMMAND_SLOTS - 1)
+		{
+			name[0] = COMMANDS[slot];
+			name[1] = '\0';
+		}
+		std::snprintf(line, sizeof(line), "%-8s %12llu %12.3f %10llu %10llu %10llu %10llu %10llu", name,
+									static_cast<unsigned long long>(count), total / 1e6,
+									static_cast<unsigned long long>(total / count),
+									static_cast<unsigned long long>(percentile(row, 0.5)),
+									static_cast<unsigned long long>(percentile(row, 0.99)),
+									static_cast<unsigned long long>(percentile(row, 0.999)),
+									static_cast<unsigned long long>(row.max.load(std::memory_order_relaxed)));
+		out << line << std::endl;
+	}
+
+	static const char *const COUNTER_NAMES[STAT_COUNTER_COUNT] = {
+			"Nodes allocated", "Nodes freed", "Searches", "Search comparisons", "History evictions"};
+	out << "List statistics:" << std::endl;
+	for (int counter = 0; counter < STAT_COUNTER_COUNT; counter++)
+		out << COUNTER_NAMES[counter] << ": " << counters[counter].load(std::memory_order_relaxed) << std::endl;
+#endif
+}
+
+// Zero every statistic
+void BrowserStats::reset()
+{
+	for (int slot = 0; slot < COMMAND_SLOTS; slot++)
+	{
+		times[slot].count.store(0);
+		times[slot].total.store(0);
+		times[slot].max.store(0);
+		for (int bucket = 0; bucket < BUCKETS; bucket++)
+			times[slot].histogram[bucket].store(0);
+	}
+	for (int counter = 0; counter < STAT_COUNTER_COUNT; counter++)
+		counters[counter].store(0);
+}
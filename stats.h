@@ -0,0 +1,120 @@
+/*
+* stats.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* Built-in instrumentation for finding out which commands are slow without a profiler. For each command it
+* keeps a call count, the total time and a latency histogram, from which percentiles are reported; the lists
+* add counters for nodes created and destroyed, searches, elements compared while searching and history
+* entries evicted by visit.
+*
+* Nothing is recorded unless the program is built with -DBROWSER_STATS (e.g. make DEFINES=-DBROWSER_STATS),
+* and even then only after enable(true), which the driver calls for --stats. When compiled in but disabled,
+* each command and each counted operation costs one relaxed load and a branch. Every update is a relaxed
+* atomic, so commands running on several threads at once are all counted.
+*/
+
+#ifndef SENG1120_STATS_H
+#define SENG1120_STATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+// The list-level counters
+enum StatCounter
+{
+    STAT_NODES_ALLOCATED,       // Nodes created by a LinkedList allocator, or chunks created by an UnrolledList
+    STAT_NODES_FREED,           // Nodes or chunks destroyed
+    STAT_SEARCHES,              // Calls to search on any list
+    STAT_SEARCH_COMPARISONS,    // Elements compared by searches that scan; an indexed search compares none
+    STAT_HISTORY_EVICTIONS,     // Oldest history entries dropped by visit to keep within the history limit
+    STAT_COUNTER_COUNT
+};
+
+class BrowserStats
+{
+public:
+    /*
+    * Precondition:    None
+    * Postcondition:   true is returned if statistics are being collected.
+    */
+    static bool enabled()
+    {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    /*
+    * Start or stop collecting. Has no effect unless built with BROWSER_STATS.
+    *
+    * Precondition:    None
+    * Postcondition:   Statistics are collected from now on if on is true, and not otherwise.
+    */
+    static void enable(bool on);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   counter has gone up by n.
+    */
+    static void count(StatCounter counter, std::uint64_t n)
+    {
+        counters[counter].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /*
+    * Record one run of the command whose code is command, taking the given time.
+    *
+    * Precondition:    None
+    * Postcondition:   The count, total time and histogram for command include this run.
+    */
+    static void record(char command, std::uint64_t nanoseconds);
+
+    /*
+    * Print a table of the commands run, with their counts, total and mean times and p50, p99, p99.9 and
+    * maximum latencies, followed by the list counters. Percentiles are accurate to within 1/16.
+    *
+    * Precondition:    None
+    * Postcondition:   The statistics collected so far have been written to out.
+    */
+    static void print(std::ostream& out);
+
+    /*
+    * Precondition:    No command is being recorded.
+    * Postcondition:   Every count, time and histogram is zero.
+    */
+    static void reset();
+
+private:
+    static const int SUB_BUCKET_BITS = 4;                       // Each power of two is split into 16 buckets
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;   // Enough for any 64-bit time
+    static const char COMMANDS[];                               // Command codes with their own row
+    static const int COMMAND_SLOTS = 22;                        // One per code in COMMANDS, then one for the rest
+
+    // Times for one command code
+    struct CommandTimes
+    {
+        std::atomic<std::uint64_t> count;
+        std::atomic<std::uint64_t> total;                       // Total nanoseconds
+        std::atomic<std::uint64_t> max;                         // Slowest run in nanoseconds
+        std::atomic<std::uint64_t> histogram[BUCKETS];          // Runs by bucket_of their time
+    };
+
+    static int slot_of(char command);                           // Row of COMMANDS for command
+    static int bucket_of(std::uint64_t nanoseconds);            // Histogram bucket holding a time
+    static std::uint64_t bucket_top(int bucket);                // Largest time in a bucket
+    static std::uint64_t percentile(const CommandTimes& times, double fraction);
+
+    inline static std::atomic<bool> active{false};
+    inline static std::atomic<std::uint64_t> counters[STAT_COUNTER_COUNT] = {};
+    static CommandTimes times[COMMAND_SLOTS];
+};
+
+// Add n to a list counter when statistics are compiled in and enabled
+#ifdef BROWSER_STATS
+#define BROWSER_STAT(counter, n) do { if (BrowserStats::enabled()) BrowserStats::count(counter, n); } while (false)
+#else
+#define BROWSER_STAT(counter, n) do { } while (false)
+#endif
+
+#endif
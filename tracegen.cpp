@@ -0,0 +1,479 @@
+/*
+ * tracegen.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ *
+ * Writes synthetic command files in the format the browser reads in file mode, for capacity planning and for
+ * benchmarking. URLs are drawn from a Zipf distribution over a fixed number of sites, commands from a weighted
+ * mix, and the work is split into sessions of random length. The output is streamed, so any number of lines can
+ * be written in constant memory, and the same options and seed always give the same file.
+ *
+ * Usage: TraceGen [options]
+ *   --lines N           total number of lines to write (default 1000000)
+ *   --urls N            number of distinct URLs (default 10000)
+ *   --zipf S            Zipf exponent for URL popularity; 0 is uniform (default 1.0)
+ *   --mix SPEC          command weights as letter:weight pairs separated by commas
+ *                       (default v:60,<:10,>:6,r:4,b:8,c:1,p:2,H:2,B:2,V:5)
+ *   --session-length N  mean number of commands per session; 0 is one endless session (default 200)
+ *   --sessions N        interleave N open sessions, prefixing each line with its session id, for --sessions
+ *                       replay; without it sessions follow each other and each ends with a c command
+ *   --seed N            random seed (default 1120)
+ *   --lf                end lines with \n instead of \r\n
+ *   --out FILE          write to FILE instead of standard output
+ */
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Commands that can appear in the mix, in the order the default mix lists them
+static const char MIX_COMMANDS[] = "v<>rbcpHBV";
+
+// Default command weights, one for each of MIX_COMMANDS
+static const unsigned DEFAULT_WEIGHTS[] = {60, 10, 6, 4, 8, 1, 2, 2, 2, 5};
+
+// Bookmark indexes for V are drawn from [0, VISIT_BOOKMARK_RANGE), so some name bookmarks that do not exist
+static const unsigned VISIT_BOOKMARK_RANGE = 8;
+
+// Largest number of steps written for < and >
+static const unsigned MAX_STEPS = 20;
+
+// Size of the output buffer
+static const std::size_t OUTPUT_CAPACITY = 1 << 20;
+
+// xoshiro256** generator, used instead of the standard engines and distributions so that a seed gives the same
+// file with every compiler
+class Random
+{
+public:
+	// Constructor for Random
+	// Precondition:   None
+	// Postcondition:  The generator is seeded from seed with splitmix64, as its authors recommend.
+	explicit Random(std::uint64_t seed)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			seed += 0x9e3779b97f4a7c15ULL;
+			std::uint64_t z = seed;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			state[i] = z ^ (z >> 31);
+		}
+	}
+
+	// Return the next 64 random bits
+	// Precondition:   None
+	// Postcondition:  The generator has advanced by one step.
+	std::uint64_t next()
+	{
+		std::uint64_t result = rotate(state[1] * 5, 7) * 9;
+		std::uint64_t shifted = state[1] << 17;
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= shifted;
+		state[3] = rotate(state[3], 45);
+		return result;
+	}
+
+	// Return a random integer in [0, bound)
+	// Precondition:   bound > 0
+	// Postcondition:  The generator has advanced by one step.
+	std::uint64_t below(std::uint64_t bound)
+	{
+		return static_cast<std::uint64_t>((static_cast<unsigned __int128>(next()) * bound) >> 64);
+	}
+
+	// Return a random double in [0, 1)
+	// Precondition:   None
+	// Postcondition:  The generator has advanced by one step.
+	double unit()
+	{
+		return static_cast<double>(next() >> 11) * 0x1.0p-53;
+	}
+
+private:
+	static std::uint64_t rotate(std::uint64_t x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	std::uint64_t state[4];
+};
+
+// Draws ranks 1..n with probability proportional to 1 / rank^exponent, by rejection-inversion (Hormann and
+// Derflinger, 1996). It takes constant time and memory per draw however many ranks there are.
+class ZipfSampler
+{
+public:
+	// Constructor for ZipfSampler
+	// Precondition:   n > 0 and exponent >= 0
+	// Postcondition:  The sampler draws ranks from 1 to n.
+	ZipfSampler(std::uint64_t n, double exponent)
+			: n(n), exponent(exponent)
+	{
+		integral_x1 = integral(1.5) - 1.0;
+		integral_n = integral(static_cast<double>(n) + 0.5);
+		squeeze = 2.0 - integral_inverse(integral(2.5) - density(2.0));
+	}
+
+	// Return a random rank in [1, n]
+	// Precondition:   None
+	// Postcondition:  The generator has advanced by one or more steps.
+	std::uint64_t sample(Random &random) const
+	{
+		if (exponent == 0.0) // Uniform, so skip the rejection loop
+			return random.below(n) + 1;
+		while (true)
+		{
+			double u = integral_n + random.unit() * (integral_x1 - integral_n);
+			double x = integral_inverse(u);
+			double rounded = std::floor(x + 0.5);
+			std::uint64_t k = (rounded < 1.0 ? 1 : (rounded > static_cast<double>(n) ? n : static_cast<std::uint64_t>(rounded)));
+			double kd = static_cast<double>(k);
+			if (kd - x <= squeeze || u >= integral(kd + 0.5) - density(kd)) // Accept
+				return k;
+		}
+	}
+
+private:
+	// The unnormalised probability of rank x
+	double density(double x) const
+	{
+		return std::exp(-exponent * std::log(x));
+	}
+
+	// An antiderivative of density
+	double integral(double x) const
+	{
+		double log_x = std::log(x);
+		return expm1_over_x((1.0 - exponent) * log_x) * log_x;
+	}
+
+	// The inverse of integral
+	double integral_inverse(double x) const
+	{
+		double t = x * (1.0 - exponent);
+		if (t < -1.0) // Rounding can take t just past the domain of log1p
+			t = -1.0;
+		return std::exp(log1p_over_x(t) * x);
+	}
+
+	// log(1 + x) / x, accurate near 0
+	static double log1p_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8)
+			return std::log1p(x) / x;
+		return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+	}
+
+	// (exp(x) - 1) / x, accurate near 0
+	static double expm1_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8)
+			return std::expm1(x) / x;
+		return 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+	}
+
+	std::uint64_t n;
+	double exponent;
+	double integral_x1;
+	double integral_n;
+	double squeeze;
+};
+
+// Collects output in a large buffer and writes it out when full
+class Output
+{
+public:
+	// Constructor for Output
+	// Precondition:   file is open for writing.
+	// Postcondition:  Nothing has been written yet.
+	explicit Output(std::FILE *file)
+			: file(file), buffer(OUTPUT_CAPACITY), used(0), failed(false)
+	{
+	}
+
+	// Append text
+	// Precondition:   text is shorter than the buffer.
+	// Postcondition:  text has been written or buffered.
+	void write(std::string_view text)
+	{
+		if (used + text.size() > buffer.size())
+			flush();
+		std::memcpy(buffer.data() + used, text.data(), text.size());
+		used += text.size();
+	}
+
+	// Append a number in decimal
+	// Precondition:   None
+	// Postcondition:  value has been written or buffered.
+	void write(std::uint64_t value)
+	{
+		char digits[24];
+		std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+		write(std::string_view(digits, result.ptr - digits));
+	}
+
+	// Write out everything buffered
+	// Precondition:   None
+	// Postcondition:  The buffer is empty; failed_write reports whether any write has failed.
+	void flush()
+	{
+		if (used > 0 && std::fwrite(buffer.data(), 1, used, file) != used)
+			failed = true;
+		used = 0;
+	}
+
+	// Return true if a write has failed
+	// Precondition:   None
+	// Postcondition:  None
+	bool failed_write() const
+	{
+		return failed;
+	}
+
+private:
+	std::FILE *file;
+	std::vector<char> buffer;
+	std::size_t used;
+	bool failed;
+};
+
+// Options set from the command line
+struct GeneratorOptions
+{
+	std::uint64_t lines;					// Total number of lines
+	std::uint64_t urls;						// Number of distinct URLs
+	double zipf;									// Zipf exponent, 0 for uniform
+	unsigned weights[sizeof(MIX_COMMANDS) - 1]; // Weight of each of MIX_COMMANDS
+	std::uint64_t session_length; // Mean commands per session, 0 for one session
+	std::uint64_t sessions;				// Number of interleaved sessions, 0 for back to back
+	std::uint64_t seed;
+	bool lf;											// End lines with \n only
+	const char *out;							// Output file, or null for standard output
+};
+
+// Parse an unsigned integer, returning false unless all of text is a number
+static bool parse_number(std::string_view text, std::uint64_t &value)
+{
+	std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+	return !text.empty() && result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// Parse a mix such as v:60,<:10 into weights, returning false if it is malformed or every weight is 0
+static bool parse_mix(std::string_view text, unsigned *weights)
+{
+	for (std::size_t i = 0; i < sizeof(MIX_COMMANDS) - 1; i++)
+		weights[i] = 0;
+	unsigned total = 0;
+	while (!text.empty())
+	{
+		std::size_t comma = text.find(',');
+		std::string_view pair = text.substr(0, comma);
+		text = (comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1));
+
+		const char *command = (pair.size() > 2 && pair[1] == ':' ? std::strchr(MIX_COMMANDS, pair[0]) : nullptr);
+		std::uint64_t weight;
+		if (command == nullptr || !parse_number(pair.substr(2), weight) || weight > 1000000)
+			return false;
+		weights[command - MIX_COMMANDS] = static_cast<unsigned>(weight);
+		total += static_cast<unsigned>(weight);
+	}
+	return total > 0;
+}
+
+// Draw a session length with the given mean; lengths are geometric so sessions vary as real ones do
+static std::uint64_t session_length(Random &random, std::uint64_t mean)
+{
+	if (mean == 0) // One session that never ends
+		return UINT64_MAX;
+	if (mean == 1)
+		return 1;
+	double u = 1.0 - random.unit(); // In (0, 1]
+	double length = 1.0 + std::floor(std::log(u) / std::log(1.0 - 1.0 / static_cast<double>(mean)));
+	return (length >= 1e18 ? static_cast<std::uint64_t>(1e18) : static_cast<std::uint64_t>(length));
+}
+
+// Write one command drawn from the mix, without its line ending
+static void write_command(Output &output, Random &random, const ZipfSampler &urls, const unsigned *weights, unsigned total)
+{
+	std::uint64_t pick = random.below(total);
+	std::size_t command = 0;
+	while (pick >= weights[command]) // Find the command whose share of the total pick falls in
+		pick -= weights[command++];
+
+	char letter = MIX_COMMANDS[command];
+	switch (letter)
+	{
+	case 'v':
+	case 'r':
+		output.write(letter == 'v' ? "v www.site" : "r www.site");
+		output.write(urls.sample(random));
+		output.write(".com");
+		break;
+	case '<':
+	case '>':
+	{
+		std::uint64_t steps = 1;
+		while (steps < MAX_STEPS && (random.next() & 1)) // Mostly short moves, as with the back button
+			steps++;
+		output.write(letter == '<' ? "< " : "> ");
+		output.write(steps);
+		break;
+	}
+	case 'V':
+		output.write("V ");
+		output.write(random.below(VISIT_BOOKMARK_RANGE));
+		break;
+	default: // The commands without arguments
+		output.write(std::string_view(&letter, 1));
+		break;
+	}
+}
+
+// Write the whole trace
+static void generate(const GeneratorOptions &options, Output &output)
+{
+	Random random(options.seed);
+	ZipfSampler urls(options.urls, options.zipf);
+	unsigned total = 0;
+	for (std::size_t i = 0; i < sizeof(MIX_COMMANDS) - 1; i++)
+		total += options.weights[i];
+	std::string_view newline = (options.lf ? "\n" : "\r\n");
+
+	if (options.sessions == 0) // Sessions one after another, each ending with a clear
+	{
+		std::uint64_t remaining = session_length(random, options.session_length);
+		for (std::uint64_t line = 0; line < options.lines; line++)
+		{
+			if (remaining == 0)
+			{
+				output.write("c");
+				remaining = session_length(random, options.session_length);
+			}
+			else
+			{
+				write_command(output, random, urls, options.weights, total);
+				remaining--;
+			}
+			output.write(newline);
+		}
+		return;
+	}
+
+	// Interleaved sessions, each line going to one of the open sessions at random
+	std::vector<std::uint64_t> ids(options.sessions);
+	std::vector<std::uint64_t> remaining(options.sessions);
+	std::uint64_t next_id = 0;
+	for (std::uint64_t i = 0; i < options.sessions; i++)
+	{
+		ids[i] = next_id++;
+		remaining[i] = session_length(random, options.session_length);
+	}
+	for (std::uint64_t line = 0; line < options.lines; line++)
+	{
+		std::uint64_t open = random.below(options.sessions);
+		output.write("s");
+		output.write(ids[open]);
+		output.write(" ");
+		write_command(output, random, urls, options.weights, total);
+		output.write(newline);
+		if (--remaining[open] == 0) // Session over, so a new one takes its place
+		{
+			ids[open] = next_id++;
+			remaining[open] = session_length(random, options.session_length);
+		}
+	}
+}
+
+static void usage(const char *program)
+{
+	std::fprintf(stderr,
+							 "Usage: %s [--lines N] [--urls N] [--zipf S] [--mix SPEC] [--session-length N] [--sessions N]\n"
+							 "       [--seed N] [--lf] [--out FILE]\n"
+							 "SPEC lists letter:weight pairs for any of %s, e.g. v:60,<:10,>:6,b:8\n",
+							 program, MIX_COMMANDS);
+}
+
+int main(int argc, char *argv[])
+{
+	GeneratorOptions options;
+	options.lines = 1000000;
+	options.urls = 10000;
+	options.zipf = 1.0;
+	for (std::size_t i = 0; i < sizeof(MIX_COMMANDS) - 1; i++)
+		options.weights[i] = DEFAULT_WEIGHTS[i];
+	options.session_length = 200;
+	options.sessions = 0;
+	options.seed = 1120;
+	options.lf = false;
+	options.out = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view flag = argv[i];
+		const char *value = (i + 1 < argc ? argv[i + 1] : nullptr);
+		bool ok = true;
+		if (flag == "--lf")
+		{
+			options.lf = true;
+			continue;
+		}
+		if (value == nullptr)
+			ok = false;
+		else if (flag == "--lines")
+			ok = parse_number(value, options.lines);
+		else if (flag == "--urls")
+			ok = parse_number(value, options.urls) && options.urls > 0;
+		else if (flag == "--zipf")
+		{
+			char *end;
+			options.zipf = std::strtod(value, &end);
+			ok = (*value != '\0' && *end == '\0' && options.zipf >= 0 && options.zipf <= 100);
+		}
+		else if (flag == "--mix")
+			ok = parse_mix(value, options.weights);
+		else if (flag == "--session-length")
+			ok = parse_number(value, options.session_length);
+		else if (flag == "--sessions")
+			ok = parse_number(value, options.sessions) && options.sessions <= 100000000;
+		else if (flag == "--seed")
+			ok = parse_number(value, options.seed);
+		else if (flag == "--out")
+			options.out = value;
+		else
+			ok = false;
+		if (!ok)
+		{
+			usage(argv[0]);
+			return 1;
+		}
+		i++; // Skip the value
+	}
+
+	std::FILE *file = (options.out == nullptr ? stdout : std::fopen(options.out, "wb"));
+	if (file == nullptr)
+	{
+		std::perror(options.out);
+		return 1;
+	}
+	Output output(file);
+	generate(options, output);
+	output.flush();
+	bool failed = output.failed_write() || std::fflush(file) != 0;
+	if (options.out != nullptr && std::fclose(file) != 0)
+		failed = true;
+	if (failed)
+	{
+		std::fprintf(stderr, "%s: write failed\n", argv[0]);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,329 @@
+/*
+* unrolled_list.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a templated unrolled linked list, which offers the same interface as LinkedList.
+* Elements are stored in doubly linked chunks of up to ChunkSize elements each, so scanning the list follows one
+* pointer per chunk rather than one per element.
+*
+* Positions mirror the sentinel nodes of LinkedList: index -1 plays the role of head and index size()
+* plays the role of tail.
+*/
+
+#ifndef SENG1120_UNROLLED_LIST_H
+#define SENG1120_UNROLLED_LIST_H
+
+#include "empty_collection_exception.h"
+#include "item_range.h"
+#include "stats.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+template <typename T, int ChunkSize = 32>
+class UnrolledList
+{
+    static_assert(ChunkSize >= 2, "a chunk must have room to split");
+
+private:
+    struct Chunk;                   // Defined below; named here for Iterator
+
+public:
+
+    /*
+    * A bidirectional iterator over the elements, first to last, as for LinkedList. It stays valid until an
+    * element is added or removed, as that can move elements between chunks.
+    */
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const T*, T*>::type pointer;
+        typedef typename std::conditional<Const, const T&, T&>::type reference;
+
+        Iterator() : list(nullptr), chunk(nullptr), slot(0) {}
+        Iterator(const Iterator<false>& other) : list(other.list), chunk(other.chunk), slot(other.slot) {}   // So an iterator converts to a const_iterator
+
+        reference operator*() const { return *chunk->item(slot); }
+        pointer operator->() const { return chunk->item(slot); }
+        Iterator& operator++();
+        Iterator operator++(int) { Iterator was = *this; ++*this; return was; }
+        Iterator& operator--();
+        Iterator operator--(int) { Iterator was = *this; --*this; return was; }
+        bool operator==(const Iterator& other) const { return chunk == other.chunk && slot == other.slot; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class UnrolledList;
+        template <bool> friend class Iterator;
+
+        Iterator(const UnrolledList* list, Chunk* chunk, int slot) : list(list), chunk(chunk), slot(slot) {}
+
+        const UnrolledList* list;
+        Chunk* chunk;               // Chunk holding the element, or null past the last one
+        int slot;                   // Slot of the element within chunk, 0 past the last one
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   A new, empty list is created.
+    */
+    UnrolledList();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The list is destroyed and all associated memory is freed.
+    */
+    ~UnrolledList();
+
+    /*
+    * The supplied data is inserted at the front of the list.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated.
+    */
+    void push_front(const T& data);
+
+    /*
+    * The supplied data is moved into the front of the list.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The first data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_front(T&& data);
+
+    /*
+    * A data item is constructed from args directly inside the first chunk.
+    *
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The first data item is updated.
+    */
+    template <typename... Args>
+    void emplace_front(Args&&... args);
+
+    /*
+    * The supplied data is inserted at the end of the list.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated.
+    */
+    void push_back(const T& data);
+
+    /*
+    * The supplied data is moved into the end of the list.
+    *
+    * Precondition:    The supplied data is valid.
+    * Postcondition:   The last data item is updated and data is left in a valid but unspecified state.
+    */
+    void push_back(T&& data);
+
+    /*
+    * A data item is constructed from args directly inside the last chunk.
+    *
+    * Precondition:    args are valid arguments for a constructor of T.
+    * Postcondition:   The last data item is updated.
+    */
+    template <typename... Args>
+    void emplace_back(Args&&... args);
+
+    /*
+    * The supplied data is inserted after the current element. A full chunk is split in two to make room.
+    *
+    * Precondition:    Current is not past the last element.
+    * Postcondition:   A new element has been added after current.
+    */
+    void insert(const T& data);
+
+    /*
+    * Remove the first data element. An exception is thrown if the list is empty.
+    *
+    * Precondition:    The list is not empty.
+    * Postcondition:   The first data element has been removed and returned. If it was current, current is before the first element.
+    */
+    T pop_front();
+
+    /*
+    * Remove the last data element. An exception is thrown if the list is empty.
+    *
+    * Precondition:    The list is not empty.
+    * Postcondition:   The last data element has been removed and returned. If it was current, current is before the first element.
+    */
+    T pop_back();
+
+    /*
+    * Remove the current element. An exception is thrown if the list is empty or current is not on an element.
+    *
+    * Precondition:    The list is not empty and current is on an element.
+    * Postcondition:   The current element has been removed and returned. Current is on the element that followed it.
+    */
+    T remove();
+
+    /*
+    * Remove every data element for which pred returns true, compacting each chunk in place and freeing the chunks
+    * left empty, so this costs O(size()) however many are removed. pred is called exactly once for each element,
+    * in order. Chunks left partly empty are not merged.
+    *
+    * Precondition:    pred can be called with a const T& and returns a value convertible to bool.
+    * Postcondition:   The matching elements have been removed and their number is returned. Current stays on its
+    *                  element if that was kept, and otherwise is before the first element.
+    */
+    template <typename Predicate>
+    int remove_if(Predicate pred);
+
+    /*
+    * Clears all data elements from the list.
+    *
+    * Precondition:    None
+    * Postcondition:   The list is empty and current is before the first element.
+    */
+    void clear();
+
+    /*
+    * Chunks are allocated as the list grows, with one emptied chunk kept for reuse, so this does nothing.
+    *
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    void reserve(int n);
+
+    /*
+    * Precondition:    The list is not empty.
+    * Postcondition:   A reference to the first data element is returned.
+    */
+    T& front() const;
+
+    /*
+    * Precondition:    The list is not empty.
+    * Postcondition:   A reference to the last data element is returned.
+    */
+    T& back() const;
+
+    /*
+    * Precondition:    The list is not empty and current is on an element.
+    * Postcondition:   A reference to the current data element is returned.
+    */
+    T& get_current() const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current is on the first element (or past the end, if the list is empty).
+    */
+    void begin();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current is on the last element (or before the start, if the list is empty).
+    */
+    void end();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current moves to the next element, unless it is already on the last one.
+    */
+    void forward();
+
+    /*
+    * Precondition:    None
+    * Postcondition:   Current moves to the previous element, unless it is already on the first one.
+    */
+    void backward();
+
+    /*
+    * Move current by the given number of elements: forward if steps is positive, backward if it is negative.
+    * Movement stops at the first or last element, as with LinkedList. Whole chunks are skipped at a time.
+    *
+    * Precondition:    None
+    * Postcondition:   Current has moved by at most |steps| elements and the signed distance moved is returned.
+    */
+    int move(int steps);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The index of the current element is returned, with -1 before the first and size() past the last.
+    */
+    int position() const;
+
+    /*
+    * Move current to the element at the supplied index, skipping whole chunks from the closest known position.
+    *
+    * Precondition:    None
+    * Postcondition:   If 0 <= index < size(), current is on that element and true is returned. Otherwise nothing changes.
+    */
+    bool seek(int index);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   current is on the first element equal to target and true is returned; otherwise nothing changes.
+    */
+    bool search(const T& target);
+
+    /*
+    * Precondition:    None
+    * Postcondition:   The number of elements is returned.
+    */
+    int size() const;
+
+    /*
+    * Precondition:    None
+    * Postcondition:   None
+    */
+    bool empty() const;
+
+    /*
+    * Return iterators over every element, first to last, as for LinkedList.
+    *
+    * Precondition:    None
+    * Postcondition:   A range over every element is returned. Nothing in the list changes.
+    */
+    ItemRange<iterator> items();
+    ItemRange<const_iterator> items() const;
+
+    /*
+    * Return an iterator to the current element, as for LinkedList.
+    *
+    * Precondition:    The list is not empty and current is on an element.
+    * Postcondition:   An iterator to the current element is returned. Nothing in the list changes.
+    */
+    const_iterator at_current() const;
+
+private:
+    // A block of up to ChunkSize elements. The live elements occupy slots [first, first + count).
+    struct Chunk
+    {
+        Chunk* next;
+        Chunk* prev;
+        int first;
+        int count;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[ChunkSize];
+
+        T* item(int slot) { return reinterpret_cast<T*>(&slots[slot]); }
+    };
+
+    UnrolledList(const UnrolledList<T, ChunkSize>&);                    // Not copyable
+    UnrolledList<T, ChunkSize>& operator=(const UnrolledList<T, ChunkSize>&);
+
+    Chunk* new_chunk(Chunk* after, int first);  // Link a new, empty chunk in after the supplied one (or first, if null)
+    void free_chunk(Chunk* chunk);              // Unlink an empty chunk, keeping it as the spare if there is none
+    void pack(Chunk* chunk);                    // Move the live elements down to slot 0
+    void locate(int index);                     // Put current on the element at index, which must be valid
+    T& current_item() const;                    // The element current is on
+
+    Chunk* first_chunk;             // Chunk holding the first element, or null if the list is empty
+    Chunk* last_chunk;              // Chunk holding the last element, or null if the list is empty
+    Chunk* spare;                   // An emptied chunk kept for reuse, so a list that stays around one size does not allocate
+    Chunk* current_chunk;           // Chunk holding the current element, or null on the head or tail position
+    int current_slot;               // Slot of the current element within current_chunk
+    int current_index;              // Logical index of the current element; -1 and count are the sentinel positions
+    int count;                      // Number of elements
+};
+
+#include "unrolled_list.hpp"
+
+#endif
@@ -0,0 +1,686 @@
+/*
+ * unrolled_list.hpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include <new>
+#include <utility>
+
+// Constructor for UnrolledList
+// Precondition:   None
+// Postcondition:  A new, empty list is created.
+template <typename T, int ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList()
+		: first_chunk(nullptr), last_chunk(nullptr), spare(nullptr), current_chunk(nullptr), current_slot(0), current_index(-1), count(0)
+{
+}
+
+// Destructor for UnrolledList
+// Precondition:   None
+// Postcondition:  The list is destroyed and all associated memory is freed.
+template <typename T, int ChunkSize>
+UnrolledList<T, ChunkSize>::~UnrolledList()
+{
+	clear();
+	if (spare != nullptr)
+	{
+		delete spare;
+		BROWSER_STAT(STAT_NODES_FREED, 1);
+	}
+}
+
+// Link a new, empty chunk in after the supplied one, or at the front if after is null
+template <typename T, int ChunkSize>
+typename UnrolledList<T, ChunkSize>::Chunk *UnrolledList<T, ChunkSize>::new_chunk(Chunk *after, int first)
+{
+	Chunk *chunk = spare;
+	if (chunk != nullptr) // Reuse the chunk that was emptied last
+		spare = nullptr;
+	else
+	{
+		chunk = new Chunk;
+		BROWSER_STAT(STAT_NODES_ALLOCATED, 1);
+	}
+	chunk->first = first;
+	chunk->count = 0;
+	chunk->prev = after;
+	chunk->next = (after == nullptr ? first_chunk : after->next);
+	if (chunk->prev != nullptr)
+		chunk->prev->next = chunk;
+	else
+		first_chunk = chunk;
+	if (chunk->next != nullptr)
+		chunk->next->prev = chunk;
+	else
+		last_chunk = chunk;
+	return chunk;
+}
+
+// Unlink an empty chunk, keeping it as the spare if there is not one already
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::free_chunk(Chunk *chunk)
+{
+	if (chunk->prev != nullptr)
+		chunk->prev->next = chunk->next;
+	else
+		first_chunk = chunk->next;
+	if (chunk->next != nullptr)
+		chunk->next->prev = chunk->prev;
+	else
+		last_chunk = chunk->prev;
+	if (spare == nullptr)
+		spare = chunk;
+	else
+	{
+		delete chunk;
+		BROWSER_STAT(STAT_NODES_FREED, 1);
+	}
+}
+
+// Move the live elements of a chunk down so that the first one is in slot 0
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::pack(Chunk *chunk)
+{
+	int shift = chunk->first;
+	if (shift == 0)
+		return;
+	for (int i = 0; i < chunk->count; i++)
+	{
+		T *source = chunk->item(shift + i);
+		if (i < shift) // Slot i has never held a live element here
+			new (chunk->item(i)) T(std::move(*source));
+		else
+			*chunk->item(i) = std::move(*source);
+	}
+	for (int i = (chunk->count > shift ? chunk->count : shift); i < shift + chunk->count; i++) // Destroy the vacated slots
+		chunk->item(i)->~T();
+	chunk->first = 0;
+	if (current_chunk == chunk)
+		current_slot -= shift;
+}
+
+// Put current on the element at index, skipping whole chunks from whichever known position is closest
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::locate(int index)
+{
+	Chunk *chunk;
+	int chunk_start; // Index of the first element of chunk
+	int from_current = index - current_index;
+	if (from_current < 0)
+		from_current = -from_current;
+	if (current_chunk != nullptr && from_current <= index && from_current < count - index)
+	{
+		chunk = current_chunk;
+		chunk_start = current_index - (current_slot - chunk->first);
+	}
+	else if (index < count - index)
+	{
+		chunk = first_chunk;
+		chunk_start = 0;
+	}
+	else
+	{
+		chunk = last_chunk;
+		chunk_start = count - chunk->count;
+	}
+	while (index >= chunk_start + chunk->count) // Skip forward a chunk at a time
+	{
+		chunk_start += chunk->count;
+		chunk = chunk->next;
+	}
+	while (index < chunk_start) // Skip backward a chunk at a time
+	{
+		chunk = chunk->prev;
+		chunk_start -= chunk->count;
+	}
+	current_chunk = chunk;
+	current_slot = chunk->first + (index - chunk_start);
+	current_index = index;
+}
+
+// Return the element current is on
+template <typename T, int ChunkSize>
+T &UnrolledList<T, ChunkSize>::current_item() const
+{
+	return *current_chunk->item(current_slot);
+}
+
+// Insert data at the front of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::push_front(const T &data)
+{
+	emplace_front(data);
+}
+
+// Move data into the front of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The first data item is updated and data has been moved from.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::push_front(T &&data)
+{
+	emplace_front(std::move(data));
+}
+
+// Construct a data element in place at the front of the list
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The first data item is updated.
+template <typename T, int ChunkSize>
+template <typename... Args>
+void UnrolledList<T, ChunkSize>::emplace_front(Args &&...args)
+{
+	Chunk *chunk = first_chunk;
+	if (chunk == nullptr || chunk->first == 0) // No free slot before the first element, so start a chunk that fills downwards
+		chunk = new_chunk(nullptr, ChunkSize);
+	try
+	{
+		new (chunk->item(chunk->first - 1)) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (chunk->count == 0) // Do not leave an empty chunk behind
+			free_chunk(chunk);
+		throw;
+	}
+	chunk->first--;
+	chunk->count++;
+	count++;
+	if (current_index >= 0) // Every element moved up one position
+		current_index++;
+}
+
+// Insert data at the end of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::push_back(const T &data)
+{
+	emplace_back(data);
+}
+
+// Move data into the end of the list
+// Precondition:   The supplied data is valid.
+// Postcondition:  The last data item is updated and data has been moved from.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::push_back(T &&data)
+{
+	emplace_back(std::move(data));
+}
+
+// Construct a data element in place at the end of the list
+// Precondition:   args are valid arguments for a constructor of T.
+// Postcondition:  The last data item is updated.
+template <typename T, int ChunkSize>
+template <typename... Args>
+void UnrolledList<T, ChunkSize>::emplace_back(Args &&...args)
+{
+	Chunk *chunk = last_chunk;
+	if (chunk == nullptr || chunk->first + chunk->count == ChunkSize) // No free slot after the last element
+		chunk = new_chunk(last_chunk, 0);
+	try
+	{
+		new (chunk->item(chunk->first + chunk->count)) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (chunk->count == 0) // Do not leave an empty chunk behind
+			free_chunk(chunk);
+		throw;
+	}
+	chunk->count++;
+	if (current_index == count) // Stay past the end, as the tail sentinel would
+		current_index++;
+	count++;
+}
+
+// Insert data after the current element
+// Precondition:   Current is not past the last element.
+// Postcondition:  A new element has been added after current.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::insert(const T &data)
+{
+	if (current_index >= count) // If current is past the end, do nothing
+		return;
+	if (current_index < 0) // Before the first element, so the new one becomes the first
+	{
+		push_front(data);
+		return;
+	}
+	Chunk *chunk = current_chunk;
+	if (chunk->count == ChunkSize) // Full, so move the upper half into a new chunk
+	{
+		int half = ChunkSize / 2;
+		Chunk *upper = new_chunk(chunk, 0);
+		for (int i = half; i < ChunkSize; i++)
+		{
+			T *source = chunk->item(chunk->first + i);
+			new (upper->item(i - half)) T(std::move(*source));
+			source->~T();
+		}
+		upper->count = ChunkSize - half;
+		chunk->count = half;
+		if (current_slot >= chunk->first + half) // Current went with the upper half
+		{
+			current_slot -= chunk->first + half;
+			current_chunk = chunk = upper;
+		}
+	}
+	if (chunk->first + chunk->count == ChunkSize) // Room only before the first element, so move them all down
+		pack(chunk);
+	int slot = current_slot + 1;
+	int end = chunk->first + chunk->count;
+	if (slot == end) // Appending to the chunk
+		new (chunk->item(slot)) T(data);
+	else
+	{
+		new (chunk->item(end)) T(std::move(*chunk->item(end - 1)));
+		for (int i = end - 1; i > slot; i--) // Shift the later elements along
+			*chunk->item(i) = std::move(*chunk->item(i - 1));
+		*chunk->item(slot) = data;
+	}
+	chunk->count++;
+	count++;
+}
+
+// Remove the first data element
+// Precondition:   The list is not empty.
+// Postcondition:  The first data element has been removed and returned.
+template <typename T, int ChunkSize>
+T UnrolledList<T, ChunkSize>::pop_front()
+{
+	if (empty()) // If list is empty, throw exception
+		throw empty_collection_exception();
+	Chunk *chunk = first_chunk;
+	T *item = chunk->item(chunk->first);
+	T data = std::move(*item);
+	item->~T();
+	chunk->first++;
+	if (--chunk->count == 0)
+		free_chunk(chunk);
+	count--;
+	if (current_index == 0) // The current element was removed
+	{
+		current_chunk = nullptr;
+		current_index = -1;
+	}
+	else if (current_index > 0) // Every element moved down one position
+		current_index--;
+	return data;
+}
+
+// Remove the last data element
+// Precondition:   The list is not empty.
+// Postcondition:  The last data element has been removed and returned.
+template <typename T, int ChunkSize>
+T UnrolledList<T, ChunkSize>::pop_back()
+{
+	if (empty()) // If list is empty, throw exception
+		throw empty_collection_exception();
+	Chunk *chunk = last_chunk;
+	T *item = chunk->item(chunk->first + chunk->count - 1);
+	T data = std::move(*item);
+	item->~T();
+	if (--chunk->count == 0)
+		free_chunk(chunk);
+	count--;
+	if (current_index == count) // The current element was removed
+	{
+		current_chunk = nullptr;
+		current_index = -1;
+	}
+	else if (current_index == count + 1) // Stay past the end
+		current_index = count;
+	return data;
+}
+
+// Remove the current element
+// Precondition:   The list is not empty and current is on an element.
+// Postcondition:  The current element has been removed and returned. Current is on the element that followed it.
+template <typename T, int ChunkSize>
+T UnrolledList<T, ChunkSize>::remove()
+{
+	if (empty() || current_chunk == nullptr) // If list is empty or current is not on an element, throw exception
+		throw empty_collection_exception();
+	Chunk *chunk = current_chunk;
+	T data = std::move(current_item());
+	int end = chunk->first + chunk->count;
+	if (current_slot == chunk->first) // First in its chunk, so nothing needs to shift
+		chunk->first++;
+	else
+	{
+		for (int i = current_slot; i < end - 1; i++) // Shift the later elements back
+			*chunk->item(i) = std::move(*chunk->item(i + 1));
+	}
+	chunk->item(current_slot == chunk->first - 1 ? current_slot : end - 1)->~T();
+	chunk->count--;
+	count--;
+	if (chunk->count == 0 || current_slot >= chunk->first + chunk->count) // The removed element ended its chunk, so move on to the next
+	{
+		Chunk *next = chunk->next;
+		if (chunk->count == 0)
+			free_chunk(chunk);
+		current_chunk = next;
+		if (next != nullptr)
+			current_slot = next->first;
+	}
+	else if (current_slot < chunk->first) // The following element is the new first in the chunk
+		current_slot = chunk->first;
+	return data; // current_index now indexes the element that followed the removed one
+}
+
+// Remove every data element for which pred returns true, compacting each chunk in one pass
+// Precondition:   pred can be called with a const T& and returns a value convertible to bool.
+// Postcondition:  The matching elements have been removed and their number is returned. Current stays on its element if that was kept, and otherwise is before the first element.
+template <typename T, int ChunkSize>
+template <typename Predicate>
+int UnrolledList<T, ChunkSize>::remove_if(Predicate pred)
+{
+	int kept = 0; // Elements kept so far, in every chunk
+	bool past_end = (current_index >= count);
+	Chunk *new_current = nullptr;
+	for (Chunk *chunk = first_chunk; chunk != nullptr;)
+	{
+		Chunk *next = chunk->next;
+		int end = chunk->first + chunk->count;
+		int slot = chunk->first; // Where the next kept element goes
+		for (int i = chunk->first; i < end; i++)
+		{
+			if (pred(static_cast<const T &>(*chunk->item(i))))
+				continue;
+			if (slot != i) // Move the element down over the removed ones
+				*chunk->item(slot) = std::move(*chunk->item(i));
+			if (current_chunk == chunk && current_slot == i)
+			{
+				new_current = chunk;
+				current_slot = slot;
+				current_index = kept;
+			}
+			slot++;
+			kept++;
+		}
+		for (int i = slot; i < end; i++) // Destroy the vacated slots
+			chunk->item(i)->~T();
+		chunk->count = slot - chunk->first;
+		if (chunk->count == 0)
+			free_chunk(chunk);
+		chunk = next;
+	}
+	int removed = count - kept;
+	count = kept;
+	current_chunk = new_current;
+	if (new_current == nullptr) // Current was removed, or on the head or tail position
+		current_index = (past_end ? count : -1);
+	return removed;
+}
+
+// Clear all data elements from the list
+// Precondition:   None
+// Postcondition:  The list is empty and current is before the first element.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::clear()
+{
+	while (first_chunk != nullptr)
+	{
+		Chunk *chunk = first_chunk;
+		for (int i = 0; i < chunk->count; i++)
+			chunk->item(chunk->first + i)->~T();
+		chunk->count = 0;
+		free_chunk(chunk);
+	}
+	count = 0;
+	current_chunk = nullptr;
+	current_index = -1;
+}
+
+// Chunks are allocated as needed, so there is nothing to set aside
+// Precondition:   None
+// Postcondition:  None
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::reserve(int)
+{
+}
+
+// Return a reference to the first data element
+// Precondition:   The list is not empty.
+// Postcondition:  A reference to the first data element is returned.
+template <typename T, int ChunkSize>
+T &UnrolledList<T, ChunkSize>::front() const
+{
+	if (empty()) // If list is empty, throw exception
+		throw empty_collection_exception();
+	return *first_chunk->item(first_chunk->first);
+}
+
+// Return a reference to the last data element
+// Precondition:   The list is not empty.
+// Postcondition:  A reference to the last data element is returned.
+template <typename T, int ChunkSize>
+T &UnrolledList<T, ChunkSize>::back() const
+{
+	if (empty()) // If list is empty, throw exception
+		throw empty_collection_exception();
+	return *last_chunk->item(last_chunk->first + last_chunk->count - 1);
+}
+
+// Return a reference to the current data element
+// Precondition:   The list is not empty and current is on an element.
+// Postcondition:  A reference to the current data element is returned.
+template <typename T, int ChunkSize>
+T &UnrolledList<T, ChunkSize>::get_current() const
+{
+	if (empty() || current_chunk == nullptr) // If list is empty or current is not on an element, throw exception
+		throw empty_collection_exception();
+	return current_item();
+}
+
+// Move current to the first element
+// Precondition:   None
+// Postcondition:  Current is on the first element (or past the end, if the list is empty).
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::begin()
+{
+	current_chunk = first_chunk;
+	current_index = 0;
+	if (current_chunk != nullptr)
+		current_slot = current_chunk->first;
+}
+
+// Move current to the last element
+// Precondition:   None
+// Postcondition:  Current is on the last element (or before the start, if the list is empty).
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::end()
+{
+	current_chunk = last_chunk;
+	current_index = count - 1;
+	if (current_chunk != nullptr)
+		current_slot = current_chunk->first + current_chunk->count - 1;
+}
+
+// Move current to the next element, unless it is already on the last one
+// Precondition:   None
+// Postcondition:  Current moves to the next element, if applicable.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::forward()
+{
+	if (current_index >= count - 1)
+		return;
+	if (current_index < 0) // From before the start onto the first element
+		begin();
+	else
+	{
+		if (++current_slot == current_chunk->first + current_chunk->count) // Off the end of this chunk
+		{
+			current_chunk = current_chunk->next;
+			current_slot = current_chunk->first;
+		}
+		current_index++;
+	}
+}
+
+// Move current to the previous element, unless it is already on the first one
+// Precondition:   None
+// Postcondition:  Current moves to the previous element, if applicable.
+template <typename T, int ChunkSize>
+void UnrolledList<T, ChunkSize>::backward()
+{
+	if (current_index <= 0)
+		return;
+	if (current_index >= count) // From past the end onto the last element
+		end();
+	else
+	{
+		if (current_slot-- == current_chunk->first) // Off the start of this chunk
+		{
+			current_chunk = current_chunk->prev;
+			current_slot = current_chunk->first + current_chunk->count - 1;
+		}
+		current_index--;
+	}
+}
+
+// Move current by the given number of elements, stopping at the first or last one
+// Precondition:   None
+// Postcondition:  Current has moved by at most |steps| elements and the signed distance moved is returned.
+template <typename T, int ChunkSize>
+int UnrolledList<T, ChunkSize>::move(int steps)
+{
+	int target = current_index;
+	if (steps > 0 && current_index < count - 1) // Forward never goes past the last element
+		target = (steps >= count - 1 - current_index) ? count - 1 : current_index + steps;
+	else if (steps < 0 && current_index > 0) // Backward never goes before the first element
+		target = (steps <= -current_index) ? 0 : current_index + steps;
+	int moved = target - current_index;
+	if (moved != 0)
+		locate(target);
+	return moved;
+}
+
+// Return the index of the current element
+// Precondition:   None
+// Postcondition:  The index of the current element is returned, with -1 before the first and size() past the last.
+template <typename T, int ChunkSize>
+int UnrolledList<T, ChunkSize>::position() const
+{
+	return current_index;
+}
+
+// Move current to the element at index
+// Precondition:   None
+// Postcondition:  If 0 <= index < size(), current is on that element and true is returned. Otherwise nothing changes.
+template <typename T, int ChunkSize>
+bool UnrolledList<T, ChunkSize>::seek(int index)
+{
+	if (index < 0 || index >= count)
+		return false;
+	locate(index);
+	return true;
+}
+
+// Move current to the first element equal to target, scanning each chunk as a contiguous block
+// Precondition:   None
+// Postcondition:  current is on the first element equal to target and true is returned; otherwise nothing changes.
+template <typename T, int ChunkSize>
+bool UnrolledList<T, ChunkSize>::search(const T &target)
+{
+	int chunk_start = 0;
+	for (Chunk *chunk = first_chunk; chunk != nullptr; chunk = chunk->next)
+	{
+		int end = chunk->first + chunk->count;
+		for (int slot = chunk->first; slot < end; slot++)
+		{
+			if (*chunk->item(slot) == target)
+			{
+				current_chunk = chunk;
+				current_slot = slot;
+				current_index = chunk_start + (slot - chunk->first);
+				BROWSER_STAT(STAT_SEARCHES, 1);
+				BROWSER_STAT(STAT_SEARCH_COMPARISONS, current_index + 1);
+				return true;
+			}
+		}
+		chunk_start += chunk->count;
+	}
+	BROWSER_STAT(STAT_SEARCHES, 1);
+	BROWSER_STAT(STAT_SEARCH_COMPARISONS, count);
+	return false;
+}
+
+// Return the number of elements
+// Precondition:   None
+// Postcondition:  The number of elements is returned.
+template <typename T, int ChunkSize>
+int UnrolledList<T, ChunkSize>::size() const
+{
+	return count;
+}
+
+// Return true if the list is empty, false otherwise
+// Precondition:   None
+// Postcondition:  None
+template <typename T, int ChunkSize>
+bool UnrolledList<T, ChunkSize>::empty() const
+{
+	return count == 0;
+}
+
+// Return iterators from the first element to past the last
+// Precondition:   None
+// Postcondition:  A range over every element is returned.
+template <typename T, int ChunkSize>
+ItemRange<typename UnrolledList<T, ChunkSize>::iterator> UnrolledList<T, ChunkSize>::items()
+{
+	return ItemRange<iterator>(iterator(this, first_chunk, first_chunk == nullptr ? 0 : first_chunk->first), iterator(this, nullptr, 0));
+}
+
+// Return const iterators from the first element to past the last
+// Precondition:   None
+// Postcondition:  A range over every element is returned.
+template <typename T, int ChunkSize>
+ItemRange<typename UnrolledList<T, ChunkSize>::const_iterator> UnrolledList<T, ChunkSize>::items() const
+{
+	return ItemRange<const_iterator>(const_iterator(this, first_chunk, first_chunk == nullptr ? 0 : first_chunk->first),
+									 const_iterator(this, nullptr, 0));
+}
+
+// Return an iterator to the current element
+// Precondition:   The list is not empty and current is on an element.
+// Postcondition:  An iterator to the current element is returned.
+template <typename T, int ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_iterator UnrolledList<T, ChunkSize>::at_current() const
+{
+	if (empty() || current_chunk == nullptr) // As for get_current
+		throw empty_collection_exception();
+	return const_iterator(this, current_chunk, current_slot);
+}
+
+// ---- Iterator --------
+
+// Move to the next element, onto the next chunk at the end of this one
+template <typename T, int ChunkSize>
+template <bool Const>
+typename UnrolledList<T, ChunkSize>::template Iterator<Const> &UnrolledList<T, ChunkSize>::Iterator<Const>::operator++()
+{
+	if (++slot == chunk->first + chunk->count)
+	{
+		chunk = chunk->next;
+		slot = (chunk == nullptr ? 0 : chunk->first);
+	}
+	return *this;
+}
+
+// Move to the previous element, back onto the last chunk from past the end
+template <typename T, int ChunkSize>
+template <bool Const>
+typename UnrolledList<T, ChunkSize>::template Iterator<Const> &UnrolledList<T, ChunkSize>::Iterator<Const>::operator--()
+{
+	if (chunk == nullptr || slot == chunk->first)
+	{
+		chunk = (chunk == nullptr ? list->last_chunk : chunk->prev);
+		slot = chunk->first + chunk->count;
+	}
+	slot--;
+	return *this;
+}
@@ -0,0 +1,124 @@
+/*
+ * url_table.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "url_table.h"
+
+// Number of changed ids at which the prefix index catches up without waiting for a query, which bounds the
+// work a query can be left with
+static const std::size_t PREFIX_SYNC_LIMIT = 1024;
+
+// Return the id of url, adding it to the table if it is new
+url_id UrlTable::intern(std::string_view url)
+{
+	std::unordered_map<std::string_view, url_id>::const_iterator entry = ids.find(url);
+	if (entry != ids.end()) // Already present, so nothing is copied
+		return entry->second;
+
+	url_id id;
+	if (free_ids.empty()) // Take a fresh id
+	{
+		id = static_cast<url_id>(entries.size());
+		entries.push_back(Entry());
+	}
+	else // Reuse the id of a dropped URL
+	{
+		id = free_ids.back();
+		free_ids.pop_back();
+	}
+	entries[id].url.assign(url.data(), url.size());
+	entries[id].references = 0;
+	ids.insert(std::make_pair(std::string_view(entries[id].url), id)); // Key on the copy the table owns
+	return id;
+}
+
+// Look up the id of url without adding it
+bool UrlTable::find(std::string_view url, url_id &id) const
+{
+	std::unordered_map<std::string_view, url_id>::const_iterator entry = ids.find(url);
+	if (entry == ids.end())
+		return false;
+	id = entry->second;
+	return true;
+}
+
+// Return the URL with the given id
+const std::string &UrlTable::lookup(url_id id) const
+{
+	return entries[id].url;
+}
+
+// Record that a list entry now stores id
+void UrlTable::retain(url_id id)
+{
+	entries[id].references++;
+	mark_changed(id);
+}
+
+// Record that a list entry no longer stores id
+void UrlTable::release(url_id id)
+{
+	if (--entries[id].references > 0)
+	{
+		mark_changed(id);
+		return;
+	}
+	if (entries[id].indexed > 0) // Take it out now, as the id may be reused for a different URL
+	{
+		prefixes.erase(id);
+		entries[id].indexed = 0;
+	}
+	ids.erase(entries[id].url); // Nothing refers to the URL any more, so drop it
+	std::string().swap(entries[id].url); // Free its text as well
+	free_ids.push_back(id);
+}
+
+// Set aside room for n URLs in the index
+void UrlTable::reserve(int n)
+{
+	ids.reserve(n);
+}
+
+// Find the k URLs with the most references starting with prefix
+void UrlTable::complete(std::string_view prefix, int k, std::vector<url_id> &found)
+{
+	sync_prefixes();
+	prefixes.complete(prefix, k, found);
+}
+
+// Note that the references of id have changed, listing it once however often it changes
+void UrlTable::mark_changed(url_id id)
+{
+	if (entries[id].changed)
+		return;
+	entries[id].changed = true;
+	changed.push_back(id);
+	if (changed.size() >= PREFIX_SYNC_LIMIT)
+		sync_prefixes();
+}
+
+// Give the prefix index the current references of every changed id
+void UrlTable::sync_prefixes()
+{
+	for (std::size_t i = 0; i < changed.size(); i++)
+	{
+		Entry &entry = entries[changed[i]];
+		entry.changed = false;
+		if (entry.references == entry.indexed) // Back where it was, or dropped before the index saw it
+			continue;
+		if (entry.indexed == 0)
+			prefixes.add(changed[i], entry.url, entry.references);
+		else
+			prefixes.rescore(changed[i], entry.references);
+		entry.indexed = entry.references;
+	}
+	changed.clear();
+}
+
+// Return the number of distinct URLs
+int UrlTable::size() const
+{
+	return static_cast<int>(ids.size());
+}
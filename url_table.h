@@ -0,0 +1,119 @@
+/*
+* url_table.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class represents a table of interned URLs. Each distinct URL is stored once and is identified by a
+* compact 32-bit id, so lists of URLs can store ids and compare them as integers.
+*
+* Every list entry that stores an id holds a reference to it. When the last reference is released the URL
+* is dropped from the table and its id may be handed out again for a different URL.
+*
+* The URLs with at least one reference are also kept in a PrefixIndex scored by their number of references, so
+* they can be completed from a prefix. retain and release only note which ids have changed; the index catches up
+* on them in one pass before a query, or once enough have built up. A URL added and dropped again in between,
+* as most are when a short history churns, never reaches the index at all.
+*/
+
+#ifndef SENG1120_URL_TABLE_H
+#define SENG1120_URL_TABLE_H
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#include "prefix_index.h"
+
+typedef std::uint32_t url_id;
+
+class UrlTable
+{
+public:
+    /**
+     * Return the id of the supplied URL, adding it to the table if it is not already present.
+     * A newly added URL has no references until retain is called for it.
+     *
+     * Precondition:  None
+     * Postcondition: url is stored in the table and its id is returned. Nothing is allocated if it was already present.
+     */
+    url_id intern(std::string_view url);
+
+    /**
+     * Look up the id of the supplied URL without adding it.
+     *
+     * Precondition:  None
+     * Postcondition: If url is in the table, id is set to its id and true is returned. Otherwise false is returned.
+     */
+    bool find(std::string_view url, url_id& id) const;
+
+    /**
+     * Return the URL with the supplied id. The reference stays valid until the URL is dropped.
+     *
+     * Precondition:  id is in the table.
+     * Postcondition: None
+     */
+    const std::string& lookup(url_id id) const;
+
+    /**
+     * Record that a list entry now stores the supplied id.
+     *
+     * Precondition:  id is in the table.
+     * Postcondition: The reference count of id has increased by 1.
+     */
+    void retain(url_id id);
+
+    /**
+     * Record that a list entry no longer stores the supplied id, dropping the URL if nothing else refers to it.
+     *
+     * Precondition:  id is in the table and has at least one reference.
+     * Postcondition: The reference count of id has decreased by 1, and the URL is dropped if it reached 0.
+     */
+    void release(url_id id);
+
+    /**
+     * Set aside room for n distinct URLs, so that interning that many does not rehash the table.
+     *
+     * Precondition:  None
+     * Postcondition: Up to n URLs can be held without the table growing its index.
+     */
+    void reserve(int n);
+
+    /**
+     * Find the k URLs with the most references that start with prefix, most first, with ties in alphabetical order.
+     *
+     * Precondition:  None
+     * Postcondition: The ids of up to k URLs, each with at least one reference, have been stored in found.
+     */
+    void complete(std::string_view prefix, int k, std::vector<url_id>& found);
+
+    /**
+     * Return the number of distinct URLs in the table.
+     *
+     * Precondition:  None
+     * Postcondition: None
+     */
+    int size() const;
+
+private:
+    struct Entry
+    {
+        std::string url;                            // The text of the URL, which the key in ids views
+        int references;                             // Number of list entries storing this id
+        int indexed;                                // Score the prefix index holds for this id, 0 if none
+        bool changed;                               // Listed in changed, waiting for the index to catch up
+    };
+
+    void mark_changed(url_id id);                   // Note that the references of id have changed
+    void sync_prefixes();                           // Bring the prefix index up to date with every changed id
+
+    std::unordered_map<std::string_view, url_id> ids;  // Every URL, mapped to its id
+    std::deque<Entry> entries;                      // Indexed by id; a deque never moves its elements, so the keys stay valid
+    std::vector<url_id> free_ids;                   // Ids of dropped URLs, ready to be reused
+    PrefixIndex prefixes;                           // Every URL with a reference, scored by its references
+    std::vector<url_id> changed;                    // Ids whose references changed since the index last caught up
+};
+
+#endif
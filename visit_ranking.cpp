@@ -0,0 +1,148 @@
+/*
+ * visit_ranking.cpp
+ * Written by : Yiyuan Li
+ * Modified   : 17/10/2026
+ */
+
+#include "visit_ranking.h"
+
+#include <algorithm>
+
+// Constructor for VisitRanking
+// Precondition:   None
+// Postcondition:  An empty ranking is created.
+VisitRanking::VisitRanking()
+		: clock(0)
+{
+}
+
+// Add a visit to id and move it up past the URLs it now ranks above
+void VisitRanking::visited(url_id id)
+{
+	clock++;
+	if (id >= position.size())
+		position.resize(id + 1, -1);
+	if (position[id] == -1) // First entry for this URL
+	{
+		RankedVisits entry = { id, 1, clock };
+		heap.push_back(entry);
+		position[id] = static_cast<int>(heap.size()) - 1;
+	}
+	else
+	{
+		heap[position[id]].visits++;
+		heap[position[id]].last = clock;
+	}
+	sift_up(position[id]);
+}
+
+// Add a visit to id without changing when it was last visited
+void VisitRanking::copied(url_id id)
+{
+	heap[position[id]].visits++;
+	sift_up(position[id]);
+}
+
+// Take a visit from id, moving it down, or out of the heap if it has none left
+void VisitRanking::left(url_id id)
+{
+	int at = position[id];
+	if (--heap[at].visits > 0)
+	{
+		sift_down(at);
+		return;
+	}
+	position[id] = -1;
+	RankedVisits moved = heap.back(); // Fill the hole with the last entry and sift it whichever way it must go
+	heap.pop_back();
+	if (at == static_cast<int>(heap.size()))
+		return;
+	place(at, moved);
+	sift_up(at);
+	sift_down(position[moved.id]);
+}
+
+// Forget every URL
+void VisitRanking::clear()
+{
+	for (std::size_t i = 0; i < heap.size(); i++)
+		position[heap[i].id] = -1;
+	heap.clear();
+}
+
+// Read the top k from the heap best first, keeping the children of every entry taken as candidates
+void VisitRanking::top(int k, std::vector<RankedVisits> &found) const
+{
+	found.clear();
+	if (k <= 0 || heap.empty())
+		return;
+
+	std::vector<int> candidates(1, 0); // Heap indexes, themselves a heap with the best on top
+	auto below = [this](int a, int b) { return ahead(b, a); };
+	while (!candidates.empty() && static_cast<int>(found.size()) < k)
+	{
+		std::pop_heap(candidates.begin(), candidates.end(), below);
+		int at = candidates.back();
+		candidates.pop_back();
+		found.push_back(heap[at]);
+		for (int child = 2 * at + 1; child <= 2 * at + 2 && child < static_cast<int>(heap.size()); child++)
+		{
+			candidates.push_back(child);
+			std::push_heap(candidates.begin(), candidates.end(), below);
+		}
+	}
+}
+
+// Return the number of URLs in the ranking
+int VisitRanking::size() const
+{
+	return static_cast<int>(heap.size());
+}
+
+// True if heap entry a has more visits than b, or as many and a later last visit
+bool VisitRanking::ahead(int a, int b) const
+{
+	if (heap[a].visits != heap[b].visits)
+		return heap[a].visits > heap[b].visits;
+	return heap[a].last > heap[b].last;
+}
+
+// Store entry at heap index at, recording where it is
+void VisitRanking::place(int at, const RankedVisits &entry)
+{
+	heap[at] = entry;
+	position[entry.id] = at;
+}
+
+// Move the entry at at up until its parent ranks above it
+void VisitRanking::sift_up(int at)
+{
+	while (at > 0 && ahead(at, (at - 1) / 2))
+	{
+		RankedVisits entry = heap[at];
+		place(at, heap[(at - 1) / 2]);
+		at = (at - 1) / 2;
+		place(at, entry);
+	}
+}
+
+// Move the entry at at down until it ranks above both its children
+void VisitRanking::sift_down(int at)
+{
+	int count = static_cast<int>(heap.size());
+	while (true)
+	{
+		int best = at;
+		for (int child = 2 * at + 1; child <= 2 * at + 2 && child < count; child++)
+		{
+			if (ahead(child, best))
+				best = child;
+		}
+		if (best == at)
+			return;
+		RankedVisits entry = heap[at];
+		place(at, heap[best]);
+		place(best, entry);
+		at = best;
+	}
+}
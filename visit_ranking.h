@@ -0,0 +1,98 @@
+/*
+* visit_ranking.h
+* Written by : Yiyuan Li (C3434681)
+* Modified   : 17/10/2026
+*
+* This class ranks the URLs in a browser's history by frecency: how many history entries each has, with ties
+* going to the one visited most recently. The Browser tells it about every entry added to or removed from the
+* history, so "the k most visited sites" is answered without scanning the history.
+*
+* The URLs are kept in a binary max-heap, with each id's place in the heap recorded so a change to one URL is
+* sifted from where it is in O(log n). A URL's last visit is the newest entry it has had in any tab, which
+* closing a tab can take away while older entries in other tabs remain. The top k are read from the heap
+* without changing it, in O(k log k).
+*/
+
+#ifndef SENG1120_VISIT_RANKING_H
+#define SENG1120_VISIT_RANKING_H
+
+#include <cstdint>
+#include <vector>
+
+#include "url_table.h"
+
+// A URL with its place in the ranking
+struct RankedVisits
+{
+    url_id id;
+    int visits;                         // Number of history entries for the URL
+    std::uint64_t last;                 // When the URL was last visited, counted in visits to any URL
+};
+
+class VisitRanking
+{
+public:
+    /**
+     * Precondition:  None
+     * Postcondition: An empty ranking is created.
+     */
+    VisitRanking();
+
+    /**
+     * Record a history entry added for id, which becomes its last visit.
+     *
+     * Precondition:  None
+     * Postcondition: id has one more visit and is the most recently visited URL.
+     */
+    void visited(url_id id);
+
+    /**
+     * Record a history entry added for id as a copy of one it already has, leaving its last visit as it was.
+     *
+     * Precondition:  id has at least one visit.
+     * Postcondition: id has one more visit.
+     */
+    void copied(url_id id);
+
+    /**
+     * Record a history entry removed for id, dropping it from the ranking if it was the last one.
+     *
+     * Precondition:  id has at least one visit.
+     * Postcondition: id has one visit fewer.
+     */
+    void left(url_id id);
+
+    /**
+     * Forget every URL, as when the whole history is cleared. The clock keeps running.
+     *
+     * Precondition:  None
+     * Postcondition: The ranking is empty.
+     */
+    void clear();
+
+    /**
+     * Find the k URLs with the most visits, the most recently visited first among equals.
+     *
+     * Precondition:  None
+     * Postcondition: Up to k URLs have been stored in found, which was cleared first, best first.
+     */
+    void top(int k, std::vector<RankedVisits>& found) const;
+
+    /**
+     * Precondition:  None
+     * Postcondition: The number of distinct URLs in the ranking is returned.
+     */
+    int size() const;
+
+private:
+    bool ahead(int a, int b) const;     // True if heap entry a ranks above heap entry b
+    void place(int at, const RankedVisits& entry); // Store entry at heap index at, recording where it is
+    void sift_up(int at);               // Move the entry at at up until its parent ranks above it
+    void sift_down(int at);             // Move the entry at at down until it ranks above its children
+
+    std::vector<RankedVisits> heap;     // Best at the front; the children of i are at 2i + 1 and 2i + 2
+    std::vector<int> position;          // Indexed by id: where the URL is in heap, or -1
+    std::uint64_t clock;                // Visits recorded so far
+};
+
+#endif